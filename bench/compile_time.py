@@ -0,0 +1,85 @@
+#!/usr/bin/python
+
+from __future__ import print_function
+
+import argparse
+import os
+import shlex
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+# Generates the dimensions of the nth distinct tensor shape. Orders go
+# from 1 to `max_order` and extents from 1 to 4, so that the amount of
+# storage stays small while the number of distinct types grows.
+def shape(n, max_order):
+    order = 1 + n % max_order
+    dims = []
+    n //= max_order
+    for _ in range(order):
+        dims.append(1 + n % 4)
+        n //= 4
+    # Make every shape distinct by tagging the last extent with n.
+    dims[-1] += 4 * n
+    return dims
+
+# Generates a translation unit that instantiates `count` distinct tensor
+# shapes and touches the metaprogramming functions of each of them.
+def translation_unit(count, max_order):
+    lines = [
+        '#include <cstddef>',
+        '#include "tensor.hpp"',
+        '',
+    ]
+    for n in range(count):
+        dims = shape(n, max_order)
+        last = ', '.join(str(d - 1) for d in dims)
+        tensor = 'sor::tensor<int, {}>'.format(', '.join(str(d) for d in dims))
+        lines += [
+            'std::size_t shape_{}() {{'.format(n),
+            '\tusing tensor_type = {};'.format(tensor),
+            '\ttensor_type tensor{};',
+            '\ttensor({}) = 1;'.format(last),
+            '\treturn sor::extent<tensor_type, {}>::value'.format(len(dims) - 1),
+            '\t\t+ sor::order<tensor_type>::value + tensor.size() + tensor({});'.format(last),
+            '}',
+            '',
+        ]
+    return '\n'.join(lines)
+
+# Compiles a single translation unit and returns the wall time in seconds
+# and the peak resident memory of the compiler in megabytes.
+def measure(cxx, flags, source):
+    command = [cxx] + flags + ['-c', source, '-o', os.devnull]
+    start = time.time()
+    process = subprocess.Popen(command)
+    _, status, usage = os.wait4(process.pid, 0)
+    elapsed = time.time() - start
+    if status != 0:
+        sys.exit('compilation failed: ' + ' '.join(command))
+    # `ru_maxrss` is reported in kilobytes on Linux and in bytes on macOS.
+    peak = usage.ru_maxrss / (1024.0 * 1024.0 if sys.platform == 'darwin' else 1024.0)
+    return elapsed, peak
+
+# Argument parsing
+parser = argparse.ArgumentParser(description='Measures the compile time and memory usage of translation units with many distinct tensor shapes.')
+parser.add_argument('--cxx', default='clang++', metavar='executable', help='compiler name')
+parser.add_argument('--flags', default='-O2 -std=c++1z -Iinclude', metavar='flags', help='compiler flags')
+parser.add_argument('--shapes', default='100,200,400', metavar='list', help='comma separated amounts of distinct shapes')
+parser.add_argument('--max-order', default=8, type=int, metavar='order', help='maximum order of the generated tensors')
+args = parser.parse_args()
+
+flags = shlex.split(args.flags)
+directory = tempfile.mkdtemp()
+
+print('{:>8} {:>10} {:>10}'.format('shapes', 'seconds', 'peak MB'))
+for count in [int(c) for c in args.shapes.split(',')]:
+    source = os.path.join(directory, 'shapes_{}.cpp'.format(count))
+    with open(source, 'w') as f:
+        f.write(translation_unit(count, args.max_order))
+    elapsed, peak = measure(args.cxx, flags, source)
+    print('{:>8} {:>10.2f} {:>10.1f}'.format(count, elapsed, peak))
+
+shutil.rmtree(directory)
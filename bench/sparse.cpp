@@ -0,0 +1,75 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+
+#include "../include/vector.hpp"
+#include "../include/matrix.hpp"
+#include "../include/sparse_matrix.hpp"
+#include "../include/algebra/matrix.hpp"
+#include "../include/algebra/sparse.hpp"
+
+namespace {
+
+	constexpr std::size_t n = 512;
+	constexpr std::size_t k = 16;
+
+	/* Average number of seconds taken by `function` over `repetitions` calls.
+	*/
+	template<typename Function>
+	double seconds(std::size_t repetitions, Function&& function) {
+		auto const start = std::chrono::steady_clock::now();
+		for (std::size_t r = 0; r < repetitions; ++r) { function(); }
+		std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+		return elapsed.count() / double(repetitions);
+	}
+
+	/* Pseudo random numbers in `[0, 1)`, reproducible between runs.
+	*/
+	double next(unsigned long long& state) {
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		return double(state >> 11) / double(1ull << 53);
+	}
+
+}
+
+/* Compares sparse matrix vector (SpMV) and sparse matrix dense matrix (SpMM)
+ * multiplication against the dense product, for matrices of increasing density.
+*/
+int main() {
+	auto dense = std::make_unique<sor::matrix<double, n, n>>();
+	auto b = std::make_unique<sor::matrix<double, n, k>>();
+	auto x = std::make_unique<sor::matrix<double, n, 1>>();
+	auto v = std::make_unique<sor::vector<double, n>>();
+	unsigned long long state = 88172645463325252ull;
+	for (std::size_t i = 0; i < n; ++i) {
+		(*x)(i, 0) = (*v)[i] = next(state);
+		for (std::size_t c = 0; c < k; ++c) { (*b)(i, c) = next(state); }
+	}
+
+	std::printf("%-10s %12s %12s %12s %12s\n", "density", "dense mv", "spmv", "dense mm", "spmm");
+	for (double density : { 0.001, 0.01, 0.05, 0.1, 0.3 }) {
+		sor::coo_matrix<double, n, n> coo;
+		for (std::size_t i = 0; i < n; ++i) {
+			for (std::size_t j = 0; j < n; ++j) {
+				double const value = next(state) < density ? next(state) : 0;
+				(*dense)(i, j) = value;
+				if (value != 0) { coo.insert(i, j, value); }
+			}
+		}
+		sor::csr_matrix<double, n, n> csr(coo);
+
+		// Keeps the products from being optimized away.
+		double volatile sink = 0;
+		double const dense_mv = seconds(20, [&] { sink += ((*dense) * (*x))(0, 0); });
+		double const sparse_mv = seconds(200, [&] { sink += (csr * (*v))[0]; });
+		double const dense_mm = seconds(5, [&] { sink += ((*dense) * (*b))(0, 0); });
+		double const sparse_mm = seconds(50, [&] { sink += (csr * (*b))(0, 0); });
+		std::printf(
+			"%-10g %10.1fus %10.1fus %10.1fus %10.1fus\n",
+			density, dense_mv * 1e6, sparse_mv * 1e6, dense_mm * 1e6, sparse_mm * 1e6
+		);
+	}
+}
\ No newline at end of file
@@ -35,10 +35,11 @@ ninja = ninja_syntax.Writer(open('build.ninja', 'w'))
 ninja.variable('ninja_required_version', '1.5')
 ninja.variable('builddir', 'obj')
 ninja.variable('include_flags', '-Iinclude -Ideps/catch/include')
-ninja.variable('compiler_flags', '-Wall -Wextra -Wno-missing-braces -O2 -Wfatal-errors -Werror -std=c++1z')
+ninja.variable('compiler_flags', '-Wall -Wextra -Wno-missing-braces -O2 -Wfatal-errors -Werror -std=c++1z -pthread')
 ninja.variable('linker_flags', '')
 ninja.variable('compiler', args.cxx)
 ninja.variable('install_path', args.install_path)
+ninja.variable('python', sys.executable)
 
 # Compilation rule
 ninja.rule('cxx',
@@ -50,6 +51,12 @@ ninja.rule('link',
         command = '$compiler $compiler_flags $linker_flags $in -o $out',
         description = 'Linking $in')
 
+# Compile time benchmarking
+ninja.rule('compile-benchmark',
+        command = '$python bench/compile_time.py --cxx $compiler --flags "$compiler_flags $include_flags"',
+        description = 'Benchmarking compile times',
+        pool = 'console')
+
 # Installing
 ninja.rule('install-headers',
         command = 'cp -vR ./include/ $install_path/include',
@@ -66,5 +73,10 @@ ninja.build('tests', 'link', inputs = obj_files)
 # Installation
 ninja.build('install', 'install-headers')
 
+# Benchmarks
+ninja.build('compile-benchmark', 'compile-benchmark')
+ninja.build(object_file('bench/sparse.cpp'), 'cxx', inputs = 'bench/sparse.cpp')
+ninja.build('sparse-benchmark', 'link', inputs = object_file('bench/sparse.cpp'))
+
 # Default build
 ninja.default('tests')
\ No newline at end of file
@@ -2,4 +2,20 @@
 
 #include "vector.hpp"
 #include "matrix.hpp"
-#include "common.hpp"
\ No newline at end of file
+#include "common.hpp"
+#include "summation.hpp"
+#include "reduction.hpp"
+#include "contraction.hpp"
+#include "lu.hpp"
+#include "cholesky.hpp"
+#include "qr.hpp"
+#include "eigen.hpp"
+#include "svd.hpp"
+#include "packed_matrix.hpp"
+#include "sparse.hpp"
+#include "iterative.hpp"
+#include "banded.hpp"
+#include "stencil.hpp"
+#include "fft.hpp"
+#include "quaternion.hpp"
+#include "quantized.hpp"
\ No newline at end of file
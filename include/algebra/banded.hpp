@@ -0,0 +1,181 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "../vector.hpp"
+#include "../matrix.hpp"
+#include "../banded_matrix.hpp"
+#include "../detail/axpy.hpp"
+#include "../detail/parallel.hpp"
+
+namespace sor {
+
+	/* Implementation details.
+	*/
+	namespace detail {
+
+		/* Number of independent tridiagonal systems that a thread solves at once, and
+		 * minimum amount of work (rows times systems) that is worth a thread.
+		*/
+		constexpr std::size_t tridiagonal_lanes = 256;
+		constexpr std::size_t tridiagonal_grain = std::size_t(1) << 15;
+
+		/* `c += A * b`, where `A` is the `n` x `n` band stored in `a` with `kl` and `ku`
+		 * diagonals, and `b` and `c` are `n` x `k` row major matrices. Only the band is
+		 * visited, so this takes `O(n * (kl + ku + 1) * k)` operations.
+		*/
+		template<typename AType, typename BType, typename CType>
+		void banded_multiply(std::size_t n, std::size_t kl, std::size_t ku, std::size_t k, AType const* a, BType const* b, CType* c) {
+			std::size_t const width = kl + ku + 1;
+			for (std::size_t i = 0; i < n; ++i) {
+				AType const* const row = a + i * width + kl - i;
+				std::size_t const first = i < kl ? 0 : i - kl;
+				std::size_t const last = std::min(n, i + ku + 1);
+				if (k == 1) {
+					CType sum = CType();
+					for (std::size_t j = first; j < last; ++j) { sum += row[j] * b[j]; }
+					c[i] += sum;
+				} else {
+					for (std::size_t j = first; j < last; ++j) { axpy(k, row[j], b + j * k, c + i * k); }
+				}
+			}
+		}
+
+		/* Solves `A * X = B` in place, for the `n` x `k` row major `x` holding `B`, by
+		 * Gaussian elimination without pivoting, overwriting the band `a` with its
+		 * factors. Without row exchanges the factors stay within the band, so this takes
+		 * `O(n * kl * (ku + k))` operations; for tridiagonal matrices it is the Thomas
+		 * algorithm. `A` must be diagonally dominant or positive definite for the
+		 * elimination to be stable.
+		*/
+		template<typename Type, typename XType>
+		void banded_solve(std::size_t n, std::size_t kl, std::size_t ku, std::size_t k, Type* a, XType* x) {
+			std::size_t const width = kl + ku + 1;
+			for (std::size_t p = 0; p < n; ++p) {
+				Type* const pivot_row = a + p * width + kl - p;
+				Type const pivot = pivot_row[p];
+				assert(pivot != Type());
+				std::size_t const last = std::min(n, p + ku + 1);
+				for (std::size_t i = p + 1; i < n && i <= p + kl; ++i) {
+					Type* const row = a + i * width + kl - i;
+					Type const factor = row[p] / pivot;
+					for (std::size_t j = p + 1; j < last; ++j) { row[j] -= factor * pivot_row[j]; }
+					axpy(k, -factor, x + p * k, x + i * k);
+				}
+			}
+			for (std::size_t p = n; p-- > 0;) {
+				Type const* const row = a + p * width + kl - p;
+				XType* const solved = x + p * k;
+				for (std::size_t j = p + 1; j < n && j <= p + ku; ++j) { axpy(k, -row[j], x + j * k, solved); }
+				for (std::size_t c = 0; c < k; ++c) { solved[c] /= row[p]; }
+			}
+		}
+
+		/* Thomas algorithm on `lanes` independent tridiagonal systems of `n` rows, whose
+		 * coefficients are interleaved: row `i` of system `l` is at `i * ld + l` in
+		 * `lower`, `diagonal`, `upper` and `x`. The systems advance in lockstep, with the
+		 * innermost loop running over contiguous lanes, which vectorizes. `x` holds the
+		 * right hand sides and is overwritten with the solutions; `scratch` needs room
+		 * for `n * lanes` elements.
+		*/
+		template<typename Type>
+		void thomas_lanes(
+			std::size_t n, std::size_t lanes, std::size_t ld,
+			Type const* lower, Type const* diagonal, Type const* upper, Type* x, Type* scratch
+		) {
+			for (std::size_t l = 0; l < lanes; ++l) {
+				Type const inverse = Type(1) / diagonal[l];
+				scratch[l] = upper[l] * inverse;
+				x[l] *= inverse;
+			}
+			for (std::size_t i = 1; i < n; ++i) {
+				Type const* const previous = scratch + (i - 1) * lanes;
+				Type* const current = scratch + i * lanes;
+				Type const* const above = x + (i - 1) * ld;
+				Type* const row = x + i * ld;
+				for (std::size_t l = 0; l < lanes; ++l) {
+					Type const sub = lower[i * ld + l];
+					Type const inverse = Type(1) / (diagonal[i * ld + l] - sub * previous[l]);
+					current[l] = upper[i * ld + l] * inverse;
+					row[l] = (row[l] - sub * above[l]) * inverse;
+				}
+			}
+			for (std::size_t i = n - 1; i-- > 0;) {
+				Type const* const current = scratch + i * lanes;
+				Type const* const below = x + (i + 1) * ld;
+				Type* const row = x + i * ld;
+				for (std::size_t l = 0; l < lanes; ++l) { row[l] -= current[l] * below[l]; }
+			}
+		}
+
+	}
+
+	/* Matrix vector multiplication, visiting only the band of the matrix.
+	*/
+	template<typename LhsType, typename RhsType, std::size_t N, std::size_t KL, std::size_t KU>
+	auto operator*(banded_matrix<LhsType, N, KL, KU> const& lhs, vector<RhsType, N> const& rhs) {
+		using common_type = typename std::common_type<LhsType, RhsType>::type;
+		vector<common_type, N> result{};
+		detail::banded_multiply(N, KL, KU, 1, lhs.data(), rhs.data(), result.data());
+		return result;
+	}
+
+	/* Multiplication of a banded matrix by a dense one.
+	*/
+	template<typename LhsType, typename RhsType, std::size_t N, std::size_t KL, std::size_t KU, std::size_t K>
+	auto operator*(banded_matrix<LhsType, N, KL, KU> const& lhs, matrix<RhsType, N, K> const& rhs) {
+		using common_type = typename std::common_type<LhsType, RhsType>::type;
+		matrix<common_type, N, K> result{};
+		detail::banded_multiply(N, KL, KU, K, lhs.data(), rhs.data(), result.data());
+		return result;
+	}
+
+	/* Solves `A * x = b` by Gaussian elimination within the band, without pivoting, in
+	 * `O(N * KL * (KU + K))` operations for `K` right hand sides (one for a vector);
+	 * tridiagonal systems are solved by the Thomas algorithm. `A` must be diagonally
+	 * dominant or symmetric positive definite.
+	*/
+	template<typename Type, std::size_t N, std::size_t KL, std::size_t KU>
+	vector<Type, N> solve(banded_matrix<Type, N, KL, KU> const& a, vector<Type, N> const& b) {
+		banded_matrix<Type, N, KL, KU> factors(a);
+		vector<Type, N> x(b);
+		detail::banded_solve(N, KL, KU, 1, factors.data(), x.data());
+		return x;
+	}
+
+	template<typename Type, std::size_t N, std::size_t KL, std::size_t KU, std::size_t K>
+	matrix<Type, N, K> solve(banded_matrix<Type, N, KL, KU> const& a, matrix<Type, N, K> const& b) {
+		banded_matrix<Type, N, KL, KU> factors(a);
+		matrix<Type, N, K> x(b);
+		detail::banded_solve(N, KL, KU, K, factors.data(), x.data());
+		return x;
+	}
+
+	/* Solves `B` independent tridiagonal systems of `N` rows in place. Column `l` of
+	 * `lower`, `diagonal` and `upper` holds the diagonals of system `l` (`lower(0, l)`
+	 * and `upper(N - 1, l)` are ignored), and column `l` of `x` its right hand side,
+	 * which is replaced with the solution. Keeping the systems interleaved lets the
+	 * Thomas algorithm run on many of them at once, across vector lanes and threads.
+	 * Each system must be diagonally dominant or positive definite.
+	*/
+	template<typename Type, std::size_t N, std::size_t B>
+	void tridiagonal_solve(
+		matrix<Type, N, B> const& lower, matrix<Type, N, B> const& diagonal, matrix<Type, N, B> const& upper, matrix<Type, N, B>& x
+	) {
+		std::size_t const grain = std::max(detail::tridiagonal_lanes, detail::tridiagonal_grain / N);
+		detail::parallel_for(B, grain, [&](std::size_t begin, std::size_t end) {
+			std::vector<Type> scratch(N * std::min(detail::tridiagonal_lanes, end - begin));
+			for (std::size_t first = begin; first < end; first += detail::tridiagonal_lanes) {
+				std::size_t const lanes = std::min(detail::tridiagonal_lanes, end - first);
+				detail::thomas_lanes(
+					N, lanes, B, lower.data() + first, diagonal.data() + first, upper.data() + first, x.data() + first, scratch.data()
+				);
+			}
+		});
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include "../tensor.hpp"
+#include "../vector.hpp"
+#include "../matrix.hpp"
+#include "../detail/gemm.hpp"
+#include "../detail/triangular.hpp"
+
+namespace sor {
+
+	/* Result of `cholesky_decompose`: `A = L * L^T`, where `L` is the lower triangular
+	 * `lower`. The decomposition only exists if `A` is `positive_definite`.
+	*/
+	template<typename Type, std::size_t N>
+	struct cholesky_decomposition {
+		matrix<Type, N, N> lower;
+		bool positive_definite;
+	};
+
+	/* Implementation details.
+	*/
+	namespace detail {
+
+		/* Matrices up to this order are factorized in a single pass, larger ones a panel
+		 * of `cholesky_block` columns at a time.
+		*/
+		constexpr std::size_t cholesky_block = 32;
+
+		/* Replaces the lower triangle of the `n` x `n` row major block `a` with its
+		 * Cholesky factor, one column at a time. Returns false as soon as a pivot isn't
+		 * positive.
+		*/
+		template<typename Type>
+		bool cholesky_factorize_block(Type* a, std::size_t lda, std::size_t n) {
+			for (std::size_t j = 0; j < n; ++j) {
+				Type* row = a + j * lda;
+				Type diagonal = row[j];
+				for (std::size_t p = 0; p < j; ++p) { diagonal -= row[p] * row[p]; }
+				if (!(diagonal > Type())) { return false; }
+				diagonal = std::sqrt(diagonal);
+				row[j] = diagonal;
+				for (std::size_t i = j + 1; i < n; ++i) {
+					Type* other = a + i * lda;
+					Type value = other[j];
+					for (std::size_t p = 0; p < j; ++p) { value -= other[p] * row[p]; }
+					other[j] = value / diagonal;
+				}
+			}
+			return true;
+		}
+
+		/* Replaces the row major `N` x `N` matrix `a` with its Cholesky factor, reading
+		 * only its lower triangle and zeroing the upper one.
+		 * Large matrices are factorized a panel at a time: the part of the panel below
+		 * the diagonal block is mirrored into the upper triangle, which is otherwise
+		 * unused, so that it can be solved for a row at a time and then multiplied by
+		 * the GEMM kernel without any scratch memory. The trailing update only computes
+		 * the lower triangle, a strip of rows at a time.
+		*/
+		template<std::size_t N, typename Type>
+		bool cholesky_factorize(Type* a) {
+			if constexpr (N <= cholesky_block) {
+				if (!cholesky_factorize_block(a, N, N)) { return false; }
+			} else {
+				for (std::size_t kk = 0; kk < N; kk += cholesky_block) {
+					std::size_t const end = (N - kk < cholesky_block) ? N : kk + cholesky_block;
+					if (!cholesky_factorize_block(a + kk * N + kk, N, end - kk)) { return false; }
+					if (end == N) { break; }
+
+					for (std::size_t i = end; i < N; ++i) {
+						for (std::size_t j = kk; j < end; ++j) { a[j * N + i] = a[i * N + j]; }
+					}
+					solve_lower<false>(end - kk, N - end, a + kk * N + kk, N, a + kk * N + end, N);
+					for (std::size_t i = end; i < N; ++i) {
+						for (std::size_t j = kk; j < end; ++j) { a[i * N + j] = a[j * N + i]; }
+					}
+
+					for (std::size_t ii = end; ii < N; ii += cholesky_block) {
+						std::size_t const ie = (N - ii < cholesky_block) ? N : ii + cholesky_block;
+						gemm(ie - ii, ie - end, end - kk, Type(-1),
+							a + ii * N + kk, N,
+							a + kk * N + end, N,
+							a + ii * N + end, N);
+					}
+				}
+			}
+			for (std::size_t i = 0; i < N; ++i) {
+				for (std::size_t j = i + 1; j < N; ++j) { a[i * N + j] = Type(); }
+			}
+			return true;
+		}
+
+	}
+
+	/* In place Cholesky decomposition.
+	 * Replaces the symmetric positive definite `a` with its lower triangular Cholesky
+	 * factor. Only the lower triangle of `a` is read. Returns false, leaving `a` partly
+	 * factorized, if it isn't positive definite.
+	*/
+	template<typename Type, std::size_t N>
+	bool cholesky_decompose_in_place(matrix<Type, N, N>& a) {
+		static_assert(std::is_floating_point<Type>::value, "Cholesky decomposition requires floating point elements");
+		return detail::cholesky_factorize<N>(a.data());
+	}
+
+	/* In place Cholesky decomposition of each matrix in a batch, returning whether
+	 * each of them is positive definite.
+	 * Example:
+	 * 		sor::tensor<double, 1000, 3, 3> covariances;
+	 * 		auto factorized = sor::cholesky_decompose_in_place(covariances);
+	*/
+	template<typename Type, std::size_t B, std::size_t N>
+	vector<bool, B> cholesky_decompose_in_place(tensor<Type, B, N, N>& batch) {
+		static_assert(std::is_floating_point<Type>::value, "Cholesky decomposition requires floating point elements");
+		vector<bool, B> result;
+		for (std::size_t b = 0; b < B; ++b) {
+			result[b] = detail::cholesky_factorize<N>(batch.data() + b * N * N);
+		}
+		return result;
+	}
+
+	/* Cholesky decomposition.
+	 * Note: Only the lower triangle of `a` is read.
+	*/
+	template<typename Type, std::size_t N>
+	cholesky_decomposition<Type, N> cholesky_decompose(matrix<Type, N, N> const& a) {
+		cholesky_decomposition<Type, N> result{ a, false };
+		result.positive_definite = cholesky_decompose_in_place(result.lower);
+		return result;
+	}
+
+	/* In place solution of `L * L^T * x = b`, given the Cholesky factor `L`. The right
+	 * hand side is replaced with the solution.
+	*/
+	template<typename Type, std::size_t N>
+	void cholesky_solve(matrix<Type, N, N> const& lower, vector<Type, N>& b) {
+		detail::solve_lower<false>(N, 1, lower.data(), N, b.data(), 1);
+		detail::solve_lower_transposed<false>(N, 1, lower.data(), N, b.data(), 1);
+	}
+
+	template<typename Type, std::size_t N, std::size_t K>
+	void cholesky_solve(matrix<Type, N, N> const& lower, matrix<Type, N, K>& b) {
+		detail::solve_lower<false>(N, K, lower.data(), N, b.data(), K);
+		detail::solve_lower_transposed<false>(N, K, lower.data(), N, b.data(), K);
+	}
+
+	/* In place solution of a batch of systems, given the batch of their Cholesky
+	 * factors.
+	*/
+	template<typename Type, std::size_t B, std::size_t N>
+	void cholesky_solve(tensor<Type, B, N, N> const& lower, tensor<Type, B, N>& b) {
+		for (std::size_t i = 0; i < B; ++i) {
+			Type const* factor = lower.data() + i * N * N;
+			Type* x = b.data() + i * N;
+			detail::solve_lower<false>(N, 1, factor, N, x, 1);
+			detail::solve_lower_transposed<false>(N, 1, factor, N, x, 1);
+		}
+	}
+
+	/* Solves `A * x = b`, given the decomposition of `A`, which must be positive
+	 * definite.
+	*/
+	template<typename Type, std::size_t N>
+	vector<Type, N> solve(cholesky_decomposition<Type, N> const& decomposition, vector<Type, N> const& b) {
+		assert(decomposition.positive_definite);
+		vector<Type, N> x(b);
+		cholesky_solve(decomposition.lower, x);
+		return x;
+	}
+
+	template<typename Type, std::size_t N, std::size_t K>
+	matrix<Type, N, K> solve(cholesky_decomposition<Type, N> const& decomposition, matrix<Type, N, K> const& b) {
+		assert(decomposition.positive_definite);
+		matrix<Type, N, K> x(b);
+		cholesky_solve(decomposition.lower, x);
+		return x;
+	}
+
+}
\ No newline at end of file
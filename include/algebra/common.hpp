@@ -1,6 +1,11 @@
 #pragma once
 
+#include <utility>
+#include <functional>
+#include <type_traits>
+
 #include "../tensor.hpp"
+#include "../detail/broadcast.hpp"
 
 namespace sor {
 
@@ -8,41 +13,37 @@ namespace sor {
 	*/
 	template<typename Type, std::size_t... Dims,
 		typename std::enable_if<sizeof...(Dims) < 3, int>::type = 0>
-	auto operator-(tensor<Type, Dims...> lhs) {
-		std::transform(lhs.begin(), lhs.end(), lhs.begin(), std::negate<void>());
+	constexpr auto operator-(tensor<Type, Dims...> lhs) {
+		for (auto& i : lhs) { i = -i; }
 		return lhs;
 	}
 
-	/* Vector & matrix sum.
+	/* Element-wise sum of tensors of the same extents, of any order.
 	*/
-	template<typename LhsType, typename RhsType, std::size_t... Dims,
-		typename std::enable_if<sizeof...(Dims) < 3, int>::type = 0>
-	auto& operator+=(tensor<LhsType, Dims...>& lhs, tensor<RhsType, Dims...> const& rhs) {
-		std::transform(lhs.begin(), lhs.end(), rhs.begin(), lhs.begin(), std::plus<void>());
+	template<typename LhsType, typename RhsType, std::size_t... Dims>
+	constexpr auto& operator+=(tensor<LhsType, Dims...>& lhs, tensor<RhsType, Dims...> const& rhs) {
+		for (std::size_t i = 0; i < lhs.size(); ++i) { lhs.data()[i] += rhs.data()[i]; }
 		return lhs;
 	}
 
-	template<typename LhsType, typename RhsType, std::size_t... Dims,
-		typename std::enable_if<sizeof...(Dims) < 3, int>::type = 0>
-	auto operator+(tensor<LhsType, Dims...> const& lhs, tensor<RhsType, Dims...> const& rhs) {
+	template<typename LhsType, typename RhsType, std::size_t... Dims>
+	constexpr auto operator+(tensor<LhsType, Dims...> const& lhs, tensor<RhsType, Dims...> const& rhs) {
 		using result_type = tensor<typename std::common_type<LhsType, RhsType>::type, Dims...>;
 		result_type result(lhs);
 		result += rhs;
 		return result;
 	}
 
-	/* Vector & matrix subtraction.
+	/* Element-wise subtraction of tensors of the same extents, of any order.
 	*/
-	template<typename LhsType, typename RhsType, std::size_t... Dims,
-		typename std::enable_if<sizeof...(Dims) < 3, int>::type = 0>
-	auto& operator-=(tensor<LhsType, Dims...>& lhs, tensor<RhsType, Dims...> const& rhs) {
-		std::transform(lhs.begin(), lhs.end(), rhs.begin(), lhs.begin(), std::minus<void>());
+	template<typename LhsType, typename RhsType, std::size_t... Dims>
+	constexpr auto& operator-=(tensor<LhsType, Dims...>& lhs, tensor<RhsType, Dims...> const& rhs) {
+		for (std::size_t i = 0; i < lhs.size(); ++i) { lhs.data()[i] -= rhs.data()[i]; }
 		return lhs;
 	}
 
-	template<typename LhsType, typename RhsType, std::size_t... Dims,
-		typename std::enable_if<sizeof...(Dims) < 3, int>::type = 0>
-	auto operator-(tensor<LhsType, Dims...> const& lhs, tensor<RhsType, Dims...> const& rhs) {
+	template<typename LhsType, typename RhsType, std::size_t... Dims>
+	constexpr auto operator-(tensor<LhsType, Dims...> const& lhs, tensor<RhsType, Dims...> const& rhs) {
 		using result_type = tensor<typename std::common_type<LhsType, RhsType>::type, Dims...>;
 		result_type result(lhs);
 		result -= rhs;
@@ -56,9 +57,9 @@ namespace sor {
 			sizeof...(Dims) < 3 && !sor::is_tensor<RhsType>::value, 
 			int
 		>::type = 0>
-	auto& operator*=(tensor<LhsType, Dims...>& lhs, RhsType const& rhs) {
+	constexpr auto& operator*=(tensor<LhsType, Dims...>& lhs, RhsType const& rhs) {
 		for (auto& i : lhs) { i *= rhs; }
-		return rhs;
+		return lhs;
 	}
 
 	template<typename LhsType, std::size_t... Dims, typename RhsType,
@@ -66,7 +67,7 @@ namespace sor {
 			sizeof...(Dims) < 3 && !sor::is_tensor<RhsType>::value, 
 			int
 		>::type = 0>
-	auto operator*(tensor<LhsType, Dims...> const& lhs, RhsType const& rhs) {
+	constexpr auto operator*(tensor<LhsType, Dims...> const& lhs, RhsType const& rhs) {
 		using result_type = tensor<typename std::common_type<LhsType, RhsType>::type, Dims...>;
 		result_type result(lhs);
 		result *= rhs;
@@ -78,7 +79,7 @@ namespace sor {
 			sizeof...(Dims) < 3 && !sor::is_tensor<LhsType>::value, 
 			int
 		>::type = 0>
-	auto operator*(LhsType const& lhs, tensor<RhsType, Dims...> const& rhs) {
+	constexpr auto operator*(LhsType const& lhs, tensor<RhsType, Dims...> const& rhs) {
 		using result_type = tensor<typename std::common_type<LhsType, RhsType>::type, Dims...>;
 		result_type result(rhs);
 		result *= lhs;
@@ -94,9 +95,9 @@ namespace sor {
 			sizeof...(Dims) < 3 && !sor::is_tensor<RhsType>::value, 
 			int
 		>::type = 0>
-	auto& operator/=(tensor<LhsType, Dims...>& lhs, RhsType const& rhs) {
+	constexpr auto& operator/=(tensor<LhsType, Dims...>& lhs, RhsType const& rhs) {
 		for (auto& i : lhs) { i /= rhs; }
-		return rhs;
+		return lhs;
 	}
 
 	template<typename LhsType, std::size_t... Dims, typename RhsType,
@@ -104,11 +105,94 @@ namespace sor {
 			sizeof...(Dims) < 3 && !sor::is_tensor<RhsType>::value, 
 			int
 		>::type = 0>
-	auto operator/(tensor<LhsType, Dims...> const& lhs, RhsType const& rhs) {
+	constexpr auto operator/(tensor<LhsType, Dims...> const& lhs, RhsType const& rhs) {
 		using result_type = tensor<typename std::common_type<LhsType, RhsType>::type, Dims...>;
 		result_type result(lhs);
 		result /= rhs;
 		return result;
 	}
 
+	/* Broadcasting sum and subtraction.
+	 * Tensors of different extents can be added and subtracted following the NumPy
+	 * broadcasting rules: extents are aligned to the right and each pair must either be
+	 * equal or contain a 1, in which case the corresponding operand is repeated along
+	 * that axis. The rules are checked at compile time and the repeated operand is
+	 * never expanded in memory. The compound assignments require the result to have the
+	 * extents of the left hand side.
+	 * Example:
+	 * 		sor::matrix<float, 2, 3> matrix({
+	 * 			1, 2, 3,
+	 * 			4, 5, 6
+	 * 		});
+	 * 		sor::vector<float, 3> bias({ 10, 20, 30 });
+	 * 		matrix += bias; // = { 11, 22, 33, 14, 25, 36 }
+	*/
+	template<typename LhsType, typename RhsType, std::size_t... LhsDims, std::size_t... RhsDims,
+		typename std::enable_if<
+			detail::is_broadcastable<
+				std::index_sequence<LhsDims...>,
+				std::index_sequence<RhsDims...>
+			>::value,
+			int
+		>::type = 0>
+	auto operator+(tensor<LhsType, LhsDims...> const& lhs, tensor<RhsType, RhsDims...> const& rhs) {
+		using broadcast = detail::broadcast<std::index_sequence<LhsDims...>, std::index_sequence<RhsDims...>>;
+		using value_type = typename std::common_type<LhsType, RhsType>::type;
+		typename broadcast::template result<value_type>::type result;
+		detail::broadcast_transform<broadcast>(lhs.data(), rhs.data(), result.data(), std::plus<value_type>());
+		return result;
+	}
+
+	template<typename LhsType, typename RhsType, std::size_t... LhsDims, std::size_t... RhsDims,
+		typename std::enable_if<
+			detail::is_broadcastable<
+				std::index_sequence<LhsDims...>,
+				std::index_sequence<RhsDims...>
+			>::value,
+			int
+		>::type = 0>
+	auto operator-(tensor<LhsType, LhsDims...> const& lhs, tensor<RhsType, RhsDims...> const& rhs) {
+		using broadcast = detail::broadcast<std::index_sequence<LhsDims...>, std::index_sequence<RhsDims...>>;
+		using value_type = typename std::common_type<LhsType, RhsType>::type;
+		typename broadcast::template result<value_type>::type result;
+		detail::broadcast_transform<broadcast>(lhs.data(), rhs.data(), result.data(), std::minus<value_type>());
+		return result;
+	}
+
+	template<typename LhsType, typename RhsType, std::size_t... LhsDims, std::size_t... RhsDims,
+		typename std::enable_if<
+			detail::is_broadcastable<
+				std::index_sequence<LhsDims...>,
+				std::index_sequence<RhsDims...>
+			>::value &&
+			detail::broadcast<
+				std::index_sequence<LhsDims...>,
+				std::index_sequence<RhsDims...>
+			>::preserves_lhs(),
+			int
+		>::type = 0>
+	auto& operator+=(tensor<LhsType, LhsDims...>& lhs, tensor<RhsType, RhsDims...> const& rhs) {
+		using broadcast = detail::broadcast<std::index_sequence<LhsDims...>, std::index_sequence<RhsDims...>>;
+		detail::broadcast_transform<broadcast>(lhs.data(), rhs.data(), lhs.data(), std::plus<void>());
+		return lhs;
+	}
+
+	template<typename LhsType, typename RhsType, std::size_t... LhsDims, std::size_t... RhsDims,
+		typename std::enable_if<
+			detail::is_broadcastable<
+				std::index_sequence<LhsDims...>,
+				std::index_sequence<RhsDims...>
+			>::value &&
+			detail::broadcast<
+				std::index_sequence<LhsDims...>,
+				std::index_sequence<RhsDims...>
+			>::preserves_lhs(),
+			int
+		>::type = 0>
+	auto& operator-=(tensor<LhsType, LhsDims...>& lhs, tensor<RhsType, RhsDims...> const& rhs) {
+		using broadcast = detail::broadcast<std::index_sequence<LhsDims...>, std::index_sequence<RhsDims...>>;
+		detail::broadcast_transform<broadcast>(lhs.data(), rhs.data(), lhs.data(), std::minus<void>());
+		return lhs;
+	}
+
 }
\ No newline at end of file
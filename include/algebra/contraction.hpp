@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstddef>
+#include <array>
+#include <utility>
+#include <type_traits>
+
+#include "../tensor.hpp"
+#include "../vector.hpp"
+#include "../matrix.hpp"
+#include "../detail/tmp.hpp"
+#include "../detail/gemm.hpp"
+#include "../detail/permute.hpp"
+
+namespace sor {
+
+	/* Implementation details.
+	*/
+	namespace detail {
+
+		/* Metaprogramming function that returns the tensor with the given value type and
+		 * extents, or the value type itself if there are no extents.
+		*/
+		template<typename Type, typename Dims>
+		struct tensor_of;
+
+		template<typename Type, std::size_t... Dims>
+		struct tensor_of<Type, std::index_sequence<Dims...>> {
+			using type = tensor<Type, Dims...>;
+		};
+
+		template<typename Type>
+		struct tensor_of<Type, std::index_sequence<>> {
+			using type = Type;
+		};
+
+		/* Returns a pointer to the elements of `input` laid out as a row major tensor
+		 * whose axes are permuted by `Perm`. If `Perm` is the identity the elements of
+		 * `input` are used directly, otherwise they are copied into `buffer`, which must
+		 * hold all of them.
+		*/
+		template<std::size_t... Dims, typename Type, std::size_t... Perm>
+		Type const* permuted_data(
+			Type const* input,
+			Type* buffer,
+			std::index_sequence<Perm...> permutation
+		) {
+			if constexpr (std::is_same<
+				std::index_sequence<Perm...>,
+				std::make_index_sequence<sizeof...(Perm)>
+			>::value) {
+				return input;
+			} else {
+				permute_copy<Dims...>(input, buffer, permutation);
+				return buffer;
+			}
+		}
+
+	}
+
+	/* Tensor contraction.
+	 * Sums the products of the elements of `lhs` and `rhs` along axis `LhsAxis` of `lhs`
+	 * and axis `RhsAxis` of `rhs`, which must have the same extent. The result has the
+	 * remaining axes of `lhs` followed by the remaining axes of `rhs`, or is a scalar if
+	 * there are none left.
+	 * The operands are permuted so that the contracted axis is the last one of `lhs`
+	 * and the first one of `rhs`, and then multiplied as matrices by the blocked GEMM
+	 * kernel. The permutation is skipped when an operand is already laid out that way.
+	 * Example:
+	 * 		sor::tensor<float, 2, 3, 4> lhs;
+	 * 		sor::matrix<float, 4, 5> rhs;
+	 * 		auto result = sor::contract<2, 0>(lhs, rhs); // sor::tensor<float, 2, 3, 5>
+	 * 		// which is `result(i, j, l) = sum_k lhs(i, j, k) * rhs(k, l)`
+	*/
+	template<std::size_t LhsAxis, std::size_t RhsAxis,
+		typename LhsType, typename RhsType, std::size_t... LhsDims, std::size_t... RhsDims>
+	auto contract(tensor<LhsType, LhsDims...> const& lhs, tensor<RhsType, RhsDims...> const& rhs) {
+
+		static_assert(LhsAxis < sizeof...(LhsDims), "axis out of range");
+		static_assert(RhsAxis < sizeof...(RhsDims), "axis out of range");
+
+		constexpr std::size_t k = detail::nth<LhsAxis, LhsDims...>();
+		static_assert(k == detail::nth<RhsAxis, RhsDims...>(), "contracted axes must have the same extent");
+
+		constexpr std::size_t m = k == 0 ? 0 : detail::multiply<LhsDims...>::value / k;
+		constexpr std::size_t n = k == 0 ? 0 : detail::multiply<RhsDims...>::value / k;
+
+		using value_type = typename std::common_type<LhsType, RhsType>::type;
+		using result_type = typename detail::tensor_of<
+			value_type,
+			typename detail::concatenate<
+				typename detail::remove_index<LhsAxis, std::index_sequence<LhsDims...>>::type,
+				typename detail::remove_index<RhsAxis, std::index_sequence<RhsDims...>>::type
+			>::type
+		>::type;
+
+		// Operands that are already laid out as matrices don't need a buffer.
+		std::array<LhsType, LhsAxis + 1 == sizeof...(LhsDims) ? 0 : m * k> lhs_buffer;
+		std::array<RhsType, RhsAxis == 0 ? 0 : k * n> rhs_buffer;
+		auto a = detail::permuted_data<LhsDims...>(
+			lhs.data(), lhs_buffer.data(),
+			typename detail::move_axis_to_back<LhsAxis, sizeof...(LhsDims)>::type()
+		);
+		auto b = detail::permuted_data<RhsDims...>(
+			rhs.data(), rhs_buffer.data(),
+			typename detail::move_axis_to_front<RhsAxis, sizeof...(RhsDims)>::type()
+		);
+
+		result_type result{};
+		value_type* c;
+		if constexpr (is_tensor<result_type>::value) {
+			c = result.data();
+		} else {
+			c = &result;
+		}
+		detail::gemm(m, n, k, value_type(1), a, k, b, n, c, n);
+		return result;
+
+	}
+
+}
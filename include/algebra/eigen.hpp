@@ -0,0 +1,330 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <type_traits>
+
+#include "../vector.hpp"
+#include "../matrix.hpp"
+
+namespace sor {
+
+	/* Result of `symmetric_eigen_decompose`: `A = V * diag(values) * V^T`, where column
+	 * `i` of the orthogonal `vectors` is the eigenvector of `values[i]`. Eigenvalues are
+	 * sorted in ascending order. The decomposition is only meaningful if the iterative
+	 * solver `converged`.
+	*/
+	template<typename Type, std::size_t N>
+	struct eigen_decomposition {
+		vector<Type, N> values;
+		matrix<Type, N, N> vectors;
+		bool converged;
+	};
+
+	/* Implementation details.
+	*/
+	namespace detail {
+
+		/* Maximum number of iterations of the eigenvalue solvers: sweeps of the Jacobi
+		 * method, or QL iterations per eigenvalue.
+		*/
+		constexpr std::size_t eigen_iterations = 50;
+
+		/* Cyclic Jacobi eigenvalue method, used for very small matrices, where each
+		 * rotation is cheap and the loops are fully unrolled. `a` is destroyed and the
+		 * eigenvectors are accumulated in the columns of `v`.
+		*/
+		template<std::size_t N, typename Type>
+		bool jacobi_eigen(Type (&a)[N][N], Type* values, Type* v) {
+			for (std::size_t i = 0; i < N; ++i) {
+				for (std::size_t j = 0; j < N; ++j) { v[i * N + j] = i == j ? Type(1) : Type(); }
+			}
+
+			bool converged = false;
+			for (std::size_t sweep = 0; sweep < eigen_iterations && !converged; ++sweep) {
+				Type off = Type(), diagonal = Type();
+				for (std::size_t p = 0; p < N; ++p) {
+					diagonal += a[p][p] * a[p][p];
+					for (std::size_t q = p + 1; q < N; ++q) { off += a[p][q] * a[p][q]; }
+				}
+				Type const epsilon = std::numeric_limits<Type>::epsilon();
+				if (off <= epsilon * epsilon * diagonal) {
+					converged = true;
+					break;
+				}
+
+				for (std::size_t p = 0; p < N; ++p) {
+					for (std::size_t q = p + 1; q < N; ++q) {
+						Type const apq = a[p][q];
+						if (apq == Type()) { continue; }
+						Type const theta = (a[q][q] - a[p][p]) / (2 * apq);
+						Type const t = std::copysign(Type(1), theta) / (std::abs(theta) + std::hypot(theta, Type(1)));
+						Type const c = 1 / std::sqrt(t * t + 1);
+						Type const s = t * c;
+						Type const tau = s / (1 + c);
+						a[p][p] -= t * apq;
+						a[q][q] += t * apq;
+						a[p][q] = a[q][p] = Type();
+						for (std::size_t r = 0; r < N; ++r) {
+							if (r != p && r != q) {
+								Type const g = a[r][p], h = a[r][q];
+								a[r][p] = a[p][r] = g - s * (h + g * tau);
+								a[r][q] = a[q][r] = h + s * (g - h * tau);
+							}
+							Type const g = v[r * N + p], h = v[r * N + q];
+							v[r * N + p] = g - s * (h + g * tau);
+							v[r * N + q] = h + s * (g - h * tau);
+						}
+					}
+				}
+			}
+
+			for (std::size_t i = 0; i < N; ++i) { values[i] = a[i][i]; }
+			for (std::size_t i = 0; i < N; ++i) {
+				std::size_t k = i;
+				for (std::size_t j = i + 1; j < N; ++j) {
+					if (values[j] < values[k]) { k = j; }
+				}
+				if (k != i) {
+					std::swap(values[i], values[k]);
+					for (std::size_t r = 0; r < N; ++r) { std::swap(v[r * N + i], v[r * N + k]); }
+				}
+			}
+			return converged;
+		}
+
+		/* Householder reduction of a symmetric `n` x `n` matrix to tridiagonal form, with
+		 * the diagonal in `d` and the subdiagonal in `e[1...]`, accumulating the
+		 * orthogonal transformation (after the EISPACK `tred2` routine).
+		 * Every element `(r, c)` of the matrix and of the transformation is stored at
+		 * `w[c * n + r]`: the inner loops then run along rows of `w`, and on return the
+		 * rows of `w` are the columns of the transformation, as `tridiagonal_ql` expects.
+		*/
+		template<typename Type>
+		void tridiagonalize(Type* w, Type* d, Type* e, std::size_t n) {
+			auto v = [w, n](std::size_t r, std::size_t c) -> Type& { return w[c * n + r]; };
+
+			for (std::size_t j = 0; j < n; ++j) { d[j] = v(n - 1, j); }
+			for (std::size_t i = n - 1; i > 0; --i) {
+				Type scale = Type(), h = Type();
+				for (std::size_t k = 0; k < i; ++k) { scale += std::abs(d[k]); }
+				if (scale == Type()) {
+					e[i] = d[i - 1];
+					for (std::size_t j = 0; j < i; ++j) {
+						d[j] = v(i - 1, j);
+						v(i, j) = Type();
+						v(j, i) = Type();
+					}
+				} else {
+					for (std::size_t k = 0; k < i; ++k) {
+						d[k] /= scale;
+						h += d[k] * d[k];
+					}
+					Type f = d[i - 1];
+					Type g = std::sqrt(h);
+					if (f > 0) { g = -g; }
+					e[i] = scale * g;
+					h -= f * g;
+					d[i - 1] = f - g;
+					for (std::size_t j = 0; j < i; ++j) { e[j] = Type(); }
+					for (std::size_t j = 0; j < i; ++j) {
+						f = d[j];
+						v(j, i) = f;
+						g = e[j] + v(j, j) * f;
+						for (std::size_t k = j + 1; k < i; ++k) {
+							g += v(k, j) * d[k];
+							e[k] += v(k, j) * f;
+						}
+						e[j] = g;
+					}
+					f = Type();
+					for (std::size_t j = 0; j < i; ++j) {
+						e[j] /= h;
+						f += e[j] * d[j];
+					}
+					Type const hh = f / (h + h);
+					for (std::size_t j = 0; j < i; ++j) { e[j] -= hh * d[j]; }
+					for (std::size_t j = 0; j < i; ++j) {
+						f = d[j];
+						g = e[j];
+						for (std::size_t k = j; k < i; ++k) { v(k, j) -= f * e[k] + g * d[k]; }
+						d[j] = v(i - 1, j);
+						v(i, j) = Type();
+					}
+				}
+				d[i] = h;
+			}
+
+			for (std::size_t i = 0; i + 1 < n; ++i) {
+				v(n - 1, i) = v(i, i);
+				v(i, i) = Type(1);
+				Type const h = d[i + 1];
+				if (h != Type()) {
+					for (std::size_t k = 0; k <= i; ++k) { d[k] = v(k, i + 1) / h; }
+					for (std::size_t j = 0; j <= i; ++j) {
+						Type g = Type();
+						for (std::size_t k = 0; k <= i; ++k) { g += v(k, i + 1) * v(k, j); }
+						for (std::size_t k = 0; k <= i; ++k) { v(k, j) -= g * d[k]; }
+					}
+				}
+				for (std::size_t k = 0; k <= i; ++k) { v(k, i + 1) = Type(); }
+			}
+			for (std::size_t j = 0; j < n; ++j) {
+				d[j] = v(n - 1, j);
+				v(n - 1, j) = Type();
+			}
+			v(n - 1, n - 1) = Type(1);
+			e[0] = Type();
+		}
+
+		/* Implicit QL iteration on the tridiagonal matrix produced by `tridiagonalize`
+		 * (after the EISPACK `tql2` routine), leaving the eigenvalues in `d` in ascending
+		 * order. If `Vectors` is true the rotations are also applied to the rows of `w`,
+		 * which become the eigenvectors; rotating rows instead of columns keeps the
+		 * innermost loops contiguous.
+		*/
+		template<bool Vectors, typename Type>
+		bool tridiagonal_ql(Type* w, Type* d, Type* e, std::size_t n) {
+			for (std::size_t i = 1; i < n; ++i) { e[i - 1] = e[i]; }
+			e[n - 1] = Type();
+
+			bool converged = true;
+			Type f = Type(), largest = Type();
+			Type const epsilon = std::numeric_limits<Type>::epsilon();
+			for (std::size_t l = 0; l < n; ++l) {
+				largest = std::max(largest, std::abs(d[l]) + std::abs(e[l]));
+				std::size_t m = l;
+				while (m < n - 1 && std::abs(e[m]) > epsilon * largest) { ++m; }
+
+				if (m > l) {
+					std::size_t iterations = 0;
+					do {
+						if (++iterations > eigen_iterations) {
+							converged = false;
+							break;
+						}
+						Type g = d[l];
+						Type p = (d[l + 1] - g) / (2 * e[l]);
+						Type r = std::hypot(p, Type(1));
+						if (p < 0) { r = -r; }
+						d[l] = e[l] / (p + r);
+						d[l + 1] = e[l] * (p + r);
+						Type const dl1 = d[l + 1];
+						Type h = g - d[l];
+						for (std::size_t i = l + 2; i < n; ++i) { d[i] -= h; }
+						f += h;
+
+						p = d[m];
+						Type c = 1, c2 = c, c3 = c;
+						Type const el1 = e[l + 1];
+						Type s = Type(), s2 = Type();
+						for (std::size_t i = m; i-- > l;) {
+							c3 = c2;
+							c2 = c;
+							s2 = s;
+							g = c * e[i];
+							h = c * p;
+							r = std::hypot(p, e[i]);
+							e[i + 1] = s * r;
+							s = e[i] / r;
+							c = p / r;
+							p = c * d[i] - s * g;
+							d[i + 1] = h + s * (c * g + s * d[i]);
+							if constexpr (Vectors) {
+								Type* const lower = w + i * n;
+								Type* const upper = lower + n;
+								for (std::size_t k = 0; k < n; ++k) {
+									Type const other = upper[k];
+									upper[k] = s * lower[k] + c * other;
+									lower[k] = c * lower[k] - s * other;
+								}
+							}
+						}
+						p = -s * s2 * c3 * el1 * e[l] / dl1;
+						e[l] = s * p;
+						d[l] = c * p;
+					} while (std::abs(e[l]) > epsilon * largest);
+				}
+				d[l] += f;
+				e[l] = Type();
+			}
+
+			for (std::size_t i = 0; i + 1 < n; ++i) {
+				std::size_t k = i;
+				for (std::size_t j = i + 1; j < n; ++j) {
+					if (d[j] < d[k]) { k = j; }
+				}
+				if (k != i) {
+					std::swap(d[i], d[k]);
+					if constexpr (Vectors) {
+						for (std::size_t c = 0; c < n; ++c) { std::swap(w[i * n + c], w[k * n + c]); }
+					}
+				}
+			}
+			return converged;
+		}
+
+		/* Eigenvalues, and eigenvectors if `Vectors` is true, of the symmetric matrix
+		 * `a`, reading only its lower triangle.
+		*/
+		template<bool Vectors, typename Type, std::size_t N>
+		bool symmetric_eigen(matrix<Type, N, N> const& a, Type* values, Type* vectors) {
+			static_assert(std::is_floating_point<Type>::value, "eigenvalue decomposition requires floating point elements");
+			if constexpr (N == 0) {
+				return true;
+			} else if constexpr (N <= 3) {
+				Type copy[N][N];
+				for (std::size_t i = 0; i < N; ++i) {
+					for (std::size_t j = 0; j <= i; ++j) { copy[i][j] = copy[j][i] = a(i, j); }
+				}
+				return jacobi_eigen<N>(copy, values, vectors);
+			} else {
+				for (std::size_t i = 0; i < N; ++i) {
+					for (std::size_t j = 0; j <= i; ++j) { vectors[i * N + j] = vectors[j * N + i] = a(i, j); }
+				}
+				Type subdiagonal[N];
+				tridiagonalize(vectors, values, subdiagonal, N);
+				bool const converged = tridiagonal_ql<Vectors>(vectors, values, subdiagonal, N);
+				if constexpr (Vectors) {
+					for (std::size_t i = 0; i < N; ++i) {
+						for (std::size_t j = i + 1; j < N; ++j) { std::swap(vectors[i * N + j], vectors[j * N + i]); }
+					}
+				}
+				return converged;
+			}
+		}
+
+	}
+
+	/* Eigenvalue decomposition of a symmetric matrix, of which only the lower triangle
+	 * is read.
+	 * Note: Matrices up to 3 x 3 are diagonalized by Jacobi rotations; larger ones are
+	 * reduced to tridiagonal form by Householder reflections and then diagonalized by
+	 * the implicit QL method.
+	 * Example:
+	 * 		sor::matrix<double, 3, 3> covariance;
+	 * 		auto eigen = sor::symmetric_eigen_decompose(covariance);
+	 * 		// the principal axis is the last column of `eigen.vectors`
+	*/
+	template<typename Type, std::size_t N>
+	eigen_decomposition<Type, N> symmetric_eigen_decompose(matrix<Type, N, N> const& a) {
+		eigen_decomposition<Type, N> result;
+		result.converged = detail::symmetric_eigen<true>(a, result.values.data(), result.vectors.data());
+		return result;
+	}
+
+	/* Eigenvalues of a symmetric matrix in ascending order, without computing the
+	 * eigenvectors where that saves time.
+	*/
+	template<typename Type, std::size_t N>
+	vector<Type, N> symmetric_eigenvalues(matrix<Type, N, N> const& a) {
+		vector<Type, N> values;
+		matrix<Type, N, N> workspace;
+		detail::symmetric_eigen<false>(a, values.data(), workspace.data());
+		return values;
+	}
+
+}
\ No newline at end of file
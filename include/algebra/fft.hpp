@@ -0,0 +1,391 @@
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "../vector.hpp"
+#include "../matrix.hpp"
+#include "../detail/parallel.hpp"
+#include "../detail/permute.hpp"
+
+namespace sor {
+
+	/* Implementation details.
+	*/
+	namespace detail {
+
+		/* Minimum number of elements whose rows a thread transforms in a two dimensional
+		 * transform.
+		*/
+		constexpr std::size_t fft_grain = std::size_t(1) << 14;
+
+		/* Cosine and sine of an angle.
+		*/
+		struct unit_root {
+			long double cos;
+			long double sin;
+		};
+
+		/* Cosine and sine of `2 * pi * k / n`, usable in constant expressions. The angle
+		 * is reduced to the nearest multiple of a quarter turn in integer arithmetic,
+		 * which is exact, and the remainder, within an eighth of a turn, is summed as a
+		 * Taylor series in `long double`.
+		*/
+		constexpr unit_root root_of_unity(std::size_t k, std::size_t n) noexcept {
+			constexpr long double pi = 3.14159265358979323846264338327950288L;
+			k %= n;
+			std::size_t const quadrant = (4 * k + n / 2) / n;
+			long double const angle = pi * ((long double)(4 * k) - (long double)(quadrant * n)) / (long double)(2 * n);
+			long double cos = 0, sin = 0, term = 1;
+			for (std::size_t i = 0; i < 20; ++i) {
+				switch (i % 4) {
+					case 0: cos += term; break;
+					case 1: sin += term; break;
+					case 2: cos -= term; break;
+					default: sin -= term; break;
+				}
+				term *= angle / (long double)(i + 1);
+			}
+			switch (quadrant % 4) {
+				case 0: return { cos, sin };
+				case 1: return { -sin, cos };
+				case 2: return { -cos, -sin };
+				default: return { sin, -cos };
+			}
+		}
+
+		/* Twiddle factors `exp(-2 * pi * i * k / N)` of a transform of length `N`, split
+		 * into real and imaginary parts. Only the roots for the multiples of
+		 * `twiddle_step` and for the indexes below it are summed as series; the others
+		 * are the product of two of them in `long double`, which keeps large tables
+		 * within the compiler's constant evaluation limits.
+		*/
+		template<typename Type, std::size_t N>
+		struct twiddle_table {
+
+			static constexpr std::size_t twiddle_step = 64;
+
+			Type re[N];
+			Type im[N];
+
+			constexpr twiddle_table() noexcept
+				: re(), im() {
+				unit_root fine[twiddle_step] = {};
+				for (std::size_t b = 0; b < twiddle_step && b < N; ++b) { fine[b] = root_of_unity(b, N); }
+				for (std::size_t a = 0; a < N; a += twiddle_step) {
+					unit_root const coarse = root_of_unity(a, N);
+					for (std::size_t b = 0; b < twiddle_step && a + b < N; ++b) {
+						long double const cos = b == 0 ? coarse.cos : coarse.cos * fine[b].cos - coarse.sin * fine[b].sin;
+						long double const sin = b == 0 ? coarse.sin : coarse.sin * fine[b].cos + coarse.cos * fine[b].sin;
+						re[a + b] = Type(cos);
+						im[a + b] = Type(-sin);
+					}
+				}
+			}
+
+		};
+
+		/* The twiddle factors of a length, computed once at compile time.
+		*/
+		template<typename Type, std::size_t N>
+		struct twiddles {
+			static constexpr twiddle_table<Type, N> value{};
+		};
+
+		/* Radix of the first pass of a transform of length `n`: four while it divides
+		 * `n`, then two, then the smallest odd prime factor.
+		*/
+		constexpr std::size_t fft_radix(std::size_t n) noexcept {
+			if (n % 4 == 0) { return 4; }
+			if (n % 2 == 0) { return 2; }
+			for (std::size_t p = 3; p * p <= n; p += 2) {
+				if (n % p == 0) { return p; }
+			}
+			return n;
+		}
+
+		/* Number of passes of a transform of length `n`.
+		*/
+		constexpr std::size_t fft_passes(std::size_t n) noexcept {
+			return n <= 1 ? 0 : 1 + fft_passes(n / fft_radix(n));
+		}
+
+		/* `value * (re + i * im)`, without the checks for infinities of the standard
+		 * operator, which keep it from being inlined.
+		*/
+		template<typename Type>
+		std::complex<Type> complex_multiply(std::complex<Type> const& value, Type re, Type im) noexcept {
+			return { value.real() * re - value.imag() * im, value.real() * im + value.imag() * re };
+		}
+
+		/* In place DFT of the `Radix` elements of `a`, taking the roots of unity from the
+		 * twiddle factors of length `N`. The inverse transform uses the conjugate roots.
+		*/
+		template<typename Type, std::size_t N, bool Inverse, std::size_t Radix>
+		struct butterfly {
+			static void run(std::complex<Type>* a) noexcept {
+				auto const& table = twiddles<Type, N>::value;
+				Type const sign = Inverse ? Type(-1) : Type(1);
+				std::complex<Type> out[Radix];
+				for (std::size_t u = 0; u < Radix; ++u) {
+					std::complex<Type> sum = a[0];
+					for (std::size_t t = 1; t < Radix; ++t) {
+						std::size_t const k = (t * u % Radix) * (N / Radix);
+						sum += complex_multiply(a[t], table.re[k], sign * table.im[k]);
+					}
+					out[u] = sum;
+				}
+				std::copy(out, out + Radix, a);
+			}
+		};
+
+		template<typename Type, std::size_t N, bool Inverse>
+		struct butterfly<Type, N, Inverse, 2> {
+			static void run(std::complex<Type>* a) noexcept {
+				std::complex<Type> const a0 = a[0];
+				a[0] = a0 + a[1];
+				a[1] = a0 - a[1];
+			}
+		};
+
+		template<typename Type, std::size_t N, bool Inverse>
+		struct butterfly<Type, N, Inverse, 4> {
+			static void run(std::complex<Type>* a) noexcept {
+				std::complex<Type> const even_sum = a[0] + a[2];
+				std::complex<Type> const even_difference = a[0] - a[2];
+				std::complex<Type> const odd_sum = a[1] + a[3];
+				std::complex<Type> const odd_difference = a[1] - a[3];
+				std::complex<Type> const rotated = Inverse
+					? std::complex<Type>(-odd_difference.imag(), odd_difference.real())
+					: std::complex<Type>(odd_difference.imag(), -odd_difference.real());
+				a[0] = even_sum + odd_sum;
+				a[1] = even_difference + rotated;
+				a[2] = even_sum - odd_sum;
+				a[3] = even_difference - rotated;
+			}
+		};
+
+		/* One pass of the Stockham autosort transform of length `N`, on the `Stride`
+		 * interleaved subsequences of length `Length` left by the previous passes. The
+		 * pass reads `x`, writes `y` and hands over to the next one with the buffers
+		 * swapped; the radix and the number of passes are resolved at compile time, and
+		 * the output ends up in natural order without a bit reversal permutation.
+		*/
+		template<typename Type, std::size_t N, bool Inverse, std::size_t Length, std::size_t Stride>
+		struct fft_pass {
+			static void run(std::complex<Type>* x, std::complex<Type>* y) noexcept {
+				constexpr std::size_t radix = fft_radix(Length);
+				constexpr std::size_t m = Length / radix;
+				auto const& table = twiddles<Type, N>::value;
+				Type const sign = Inverse ? Type(-1) : Type(1);
+				for (std::size_t p = 0; p < m; ++p) {
+					Type re[radix];
+					Type im[radix];
+					for (std::size_t u = 0; u < radix; ++u) {
+						re[u] = table.re[p * u * Stride];
+						im[u] = sign * table.im[p * u * Stride];
+					}
+					for (std::size_t q = 0; q < Stride; ++q) {
+						std::complex<Type> a[radix];
+						for (std::size_t t = 0; t < radix; ++t) { a[t] = x[q + Stride * (p + t * m)]; }
+						butterfly<Type, N, Inverse, radix>::run(a);
+						std::complex<Type>* const out = y + q + Stride * radix * p;
+						out[0] = a[0];
+						for (std::size_t u = 1; u < radix; ++u) { out[Stride * u] = complex_multiply(a[u], re[u], im[u]); }
+					}
+				}
+				fft_pass<Type, N, Inverse, m, Stride * radix>::run(y, x);
+			}
+		};
+
+		template<typename Type, std::size_t N, bool Inverse, std::size_t Stride>
+		struct fft_pass<Type, N, Inverse, 1, Stride> {
+			static void run(std::complex<Type>*, std::complex<Type>*) noexcept {}
+		};
+
+		/* Unscaled transform of the `N` elements of `data` in place, using the `N`
+		 * elements of `work` as scratch.
+		*/
+		template<typename Type, std::size_t N, bool Inverse>
+		void fft_run(std::complex<Type>* data, std::complex<Type>* work) noexcept {
+			fft_pass<Type, N, Inverse, N, 1>::run(data, work);
+			if constexpr (fft_passes(N) % 2 == 1) { std::copy(work, work + N, data); }
+		}
+
+		/* Transform of the `N` real elements of `in` into the `N / 2 + 1` elements of the
+		 * spectrum that are not conjugates of others. For even `N`, the even and odd
+		 * elements are packed as the real and imaginary parts of a sequence of half the
+		 * length, whose transform is then split; `work` needs room for `2 * N` elements.
+		*/
+		template<typename Type, std::size_t N>
+		void rfft_run(Type const* in, std::complex<Type>* out, std::complex<Type>* work) noexcept {
+			if constexpr (N % 2 == 1) {
+				for (std::size_t i = 0; i < N; ++i) { work[i] = in[i]; }
+				fft_run<Type, N, false>(work, work + N);
+				std::copy(work, work + N / 2 + 1, out);
+			} else {
+				constexpr std::size_t h = N / 2;
+				auto const& table = twiddles<Type, N>::value;
+				for (std::size_t k = 0; k < h; ++k) { out[k] = std::complex<Type>(in[2 * k], in[2 * k + 1]); }
+				fft_run<Type, h, false>(out, work);
+				auto split = [&table](std::complex<Type> const& z, std::complex<Type> const& mirror, std::size_t k) {
+					std::complex<Type> const even = (z + std::conj(mirror)) * Type(0.5);
+					std::complex<Type> const difference = (z - std::conj(mirror)) * Type(0.5);
+					std::complex<Type> const odd(difference.imag(), -difference.real());
+					return even + complex_multiply(odd, table.re[k], table.im[k]);
+				};
+				std::complex<Type> const first = out[0];
+				out[0] = std::complex<Type>(first.real() + first.imag(), 0);
+				out[h] = std::complex<Type>(first.real() - first.imag(), 0);
+				for (std::size_t k = 1; 2 * k <= h; ++k) {
+					std::complex<Type> const z = out[k];
+					std::complex<Type> const mirror = out[h - k];
+					out[k] = split(z, mirror, k);
+					out[h - k] = split(mirror, z, h - k);
+				}
+			}
+		}
+
+		/* Inverse of `rfft_run`, scaled so that it gives back the original sequence;
+		 * `work` needs room for `2 * N` elements.
+		*/
+		template<typename Type, std::size_t N>
+		void inverse_rfft_run(std::complex<Type> const* in, Type* out, std::complex<Type>* work) noexcept {
+			if constexpr (N % 2 == 1) {
+				for (std::size_t k = 0; k <= N / 2; ++k) {
+					work[k] = in[k];
+					if (k != 0) { work[N - k] = std::conj(in[k]); }
+				}
+				fft_run<Type, N, true>(work, work + N);
+				for (std::size_t i = 0; i < N; ++i) { out[i] = work[i].real() / Type(N); }
+			} else {
+				constexpr std::size_t h = N / 2;
+				auto const& table = twiddles<Type, N>::value;
+				for (std::size_t k = 0; k < h; ++k) {
+					std::complex<Type> const mirror = std::conj(in[h - k]);
+					std::complex<Type> const even = (in[k] + mirror) * Type(0.5);
+					std::complex<Type> const odd = complex_multiply((in[k] - mirror) * Type(0.5), table.re[k], -table.im[k]);
+					work[k] = even + std::complex<Type>(-odd.imag(), odd.real());
+				}
+				fft_run<Type, h, true>(work, work + h);
+				for (std::size_t k = 0; k < h; ++k) {
+					out[2 * k] = work[k].real() / Type(h);
+					out[2 * k + 1] = work[k].imag() / Type(h);
+				}
+			}
+		}
+
+		/* Unscaled transform of each of the `M` rows of length `N` of `data`, with rows
+		 * split between threads.
+		*/
+		template<typename Type, std::size_t M, std::size_t N, bool Inverse>
+		void fft_rows(std::complex<Type>* data) {
+			parallel_for(M, std::max<std::size_t>(1, fft_grain / N), [data](std::size_t begin, std::size_t end) {
+				std::vector<std::complex<Type>> work(N);
+				for (std::size_t i = begin; i < end; ++i) { fft_run<Type, N, Inverse>(data + i * N, work.data()); }
+			});
+		}
+
+		/* Unscaled two dimensional transform of the `M` x `N` row major `data` in place:
+		 * the rows are transformed, the matrix is transposed a tile at a time so that
+		 * the columns become contiguous, transformed in turn and transposed back.
+		*/
+		template<typename Type, std::size_t M, std::size_t N, bool Inverse>
+		void fft_2d(std::complex<Type>* data) {
+			std::vector<std::complex<Type>> transposed(M * N);
+			fft_rows<Type, M, N, Inverse>(data);
+			transpose(data, M, N, transposed.data());
+			fft_rows<Type, N, M, Inverse>(transposed.data());
+			transpose(transposed.data(), N, M, data);
+		}
+
+	}
+
+	/* Discrete Fourier transform `X[k] = sum x[n] * exp(-2 * pi * i * k * n / N)`, by a
+	 * mixed radix Stockham FFT. `N` may have any factors: the passes use radix 4 and 2
+	 * first, then each remaining prime factor `p` as a direct `O(p^2)` DFT, so that
+	 * the transform takes `O(N * (sum of the prime factors of N))` operations:
+	 * `O(N log N)` for smooth lengths, but `O(N^2)` for a prime one. Twiddle factors
+	 * are computed at compile time, so large or prime lengths are limited by the
+	 * compiler's constant evaluation limits.
+	 * Example:
+	 * 		sor::vector<std::complex<double>, 8> x({ 1, 1, 1, 1, 0, 0, 0, 0 });
+	 * 		auto spectrum = sor::fft(x);
+	*/
+	template<typename Type, std::size_t N>
+	vector<std::complex<Type>, N> fft(vector<std::complex<Type>, N> const& x) {
+		static_assert(std::is_floating_point<Type>::value, "the FFT is defined on complex floating point numbers");
+		vector<std::complex<Type>, N> result(x);
+		std::vector<std::complex<Type>> work(N);
+		detail::fft_run<Type, N, false>(result.data(), work.data());
+		return result;
+	}
+
+	/* Inverse discrete Fourier transform, scaled by `1 / N` so that it undoes `fft`.
+	*/
+	template<typename Type, std::size_t N>
+	vector<std::complex<Type>, N> inverse_fft(vector<std::complex<Type>, N> const& spectrum) {
+		static_assert(std::is_floating_point<Type>::value, "the FFT is defined on complex floating point numbers");
+		vector<std::complex<Type>, N> result(spectrum);
+		std::vector<std::complex<Type>> work(N);
+		detail::fft_run<Type, N, true>(result.data(), work.data());
+		for (std::size_t i = 0; i < N; ++i) { result.data()[i] *= Type(1) / Type(N); }
+		return result;
+	}
+
+	/* Discrete Fourier transform of a real sequence. The spectrum of real data is
+	 * conjugate symmetric, so only its first `N / 2 + 1` elements are returned; for
+	 * even `N` they are computed by a complex transform of half the length.
+	*/
+	template<typename Type, std::size_t N>
+	vector<std::complex<Type>, N / 2 + 1> rfft(vector<Type, N> const& x) {
+		static_assert(std::is_floating_point<Type>::value, "rfft is defined on real floating point numbers");
+		vector<std::complex<Type>, N / 2 + 1> result;
+		std::vector<std::complex<Type>> work(2 * N);
+		detail::rfft_run<Type, N>(x.data(), result.data(), work.data());
+		return result;
+	}
+
+	/* Inverse of `rfft`: the real sequence of length `N` whose spectrum starts with
+	 * `spectrum`. `N` can't be deduced, since both `2 * K - 2` and `2 * K - 1` have `K`
+	 * non redundant elements, and must be given explicitly.
+	 * Example:
+	 * 		auto x = sor::inverse_rfft<8>(sor::rfft(y));
+	*/
+	template<std::size_t N, typename Type, std::size_t K>
+	vector<Type, N> inverse_rfft(vector<std::complex<Type>, K> const& spectrum) {
+		static_assert(std::is_floating_point<Type>::value, "rfft is defined on real floating point numbers");
+		static_assert(K == N / 2 + 1, "the spectrum of a real sequence of length N has N / 2 + 1 elements");
+		vector<Type, N> result;
+		std::vector<std::complex<Type>> work(2 * N);
+		detail::inverse_rfft_run<Type, N>(spectrum.data(), result.data(), work.data());
+		return result;
+	}
+
+	/* Two dimensional discrete Fourier transform, computed by transforming the rows,
+	 * then the columns after a blocked transpose. Rows are split between threads for
+	 * large matrices.
+	*/
+	template<typename Type, std::size_t M, std::size_t N>
+	matrix<std::complex<Type>, M, N> fft(matrix<std::complex<Type>, M, N> const& x) {
+		static_assert(std::is_floating_point<Type>::value, "the FFT is defined on complex floating point numbers");
+		matrix<std::complex<Type>, M, N> result(x);
+		detail::fft_2d<Type, M, N, false>(result.data());
+		return result;
+	}
+
+	/* Inverse two dimensional discrete Fourier transform, scaled by `1 / (M * N)`.
+	*/
+	template<typename Type, std::size_t M, std::size_t N>
+	matrix<std::complex<Type>, M, N> inverse_fft(matrix<std::complex<Type>, M, N> const& spectrum) {
+		static_assert(std::is_floating_point<Type>::value, "the FFT is defined on complex floating point numbers");
+		matrix<std::complex<Type>, M, N> result(spectrum);
+		detail::fft_2d<Type, M, N, true>(result.data());
+		for (std::size_t i = 0; i < M * N; ++i) { result.data()[i] *= Type(1) / Type(M * N); }
+		return result;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,452 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "../type_traits.hpp"
+#include "../vector.hpp"
+#include "../matrix.hpp"
+#include "../sparse_matrix.hpp"
+#include "../detail/axpy.hpp"
+#include "../detail/parallel.hpp"
+#include "sparse.hpp"
+
+namespace sor {
+
+	/* When an iterative solver stops: once the norm of the residual `b - A * x` is at
+	 * most `tolerance` times the norm of `b`, or after `iterations` iterations.
+	*/
+	template<typename Type>
+	struct iteration_limits {
+		Type tolerance = Type(1e-10);
+		std::size_t iterations = 1000;
+	};
+
+	/* Result of an iterative solver: the number of `iterations` performed, the last
+	 * relative `residual` norm and whether it is within the tolerance.
+	*/
+	template<typename Type>
+	struct iterative_result {
+		std::size_t iterations;
+		Type residual;
+		bool converged;
+	};
+
+	/* Buffers used by the iterative solvers, which are only resized (so never reallocated
+	 * when reused for systems of the same size) before the first iteration.
+	 * Note: The buffers don't cover threads. A sweep over more rows than a thread
+	 * takes starts its threads through `detail::parallel_for` on every iteration, at
+	 * a cost in the tens of microseconds per sweep.
+	*/
+	template<typename Type>
+	struct iterative_workspace {
+		std::vector<Type> vectors;
+		std::vector<Type> partials;
+		std::vector<std::size_t> order;
+		std::vector<std::size_t> colors;
+		std::vector<std::size_t> scratch;
+	};
+
+	/* Implementation details.
+	*/
+	namespace detail {
+
+		/* Monitor of the solvers that aren't given one, which compiles away.
+		*/
+		struct unmonitored {
+			template<typename Type>
+			constexpr bool operator()(std::size_t, Type const&) const noexcept { return true; }
+		};
+
+		/* Rows of a dense matrix, and their cost relative to each other.
+		*/
+		template<typename Type, std::size_t N>
+		constexpr std::size_t row_weight(matrix<Type, N, N> const&) noexcept {
+			return N;
+		}
+
+		template<typename Type, std::size_t N>
+		std::size_t row_weight(csr_matrix<Type, N, N> const& a) noexcept {
+			return a.non_zeros() / N + 1;
+		}
+
+		/* Minimum number of rows that a thread relaxes at once.
+		*/
+		template<typename Matrix>
+		std::size_t row_grain(Matrix const& a) noexcept {
+			return std::max<std::size_t>(1, sparse_grain / row_weight(a));
+		}
+
+		/* Returns `sum(a(i, j) * x[j])` for `j != i`, storing `a(i, i)` in `diagonal`.
+		*/
+		template<typename Type, std::size_t N>
+		Type off_diagonal(matrix<Type, N, N> const& a, std::size_t i, Type const* x, Type& diagonal) noexcept {
+			Type sum = Type();
+			for (std::size_t j = 0; j < N; ++j) { sum += a(i, j) * x[j]; }
+			diagonal = a(i, i);
+			return sum - diagonal * x[i];
+		}
+
+		template<typename Type, std::size_t N>
+		Type off_diagonal(csr_matrix<Type, N, N> const& a, std::size_t i, Type const* x, Type& diagonal) noexcept {
+			Type sum = Type();
+			diagonal = Type();
+			for (std::size_t e = a.row_offsets()[i]; e < a.row_offsets()[i + 1]; ++e) {
+				std::size_t const j = a.column_indexes()[e];
+				if (j == i) {
+					diagonal = a.values()[e];
+				} else {
+					sum += a.values()[e] * x[j];
+				}
+			}
+			return sum;
+		}
+
+		/* `y = A * x`.
+		*/
+		template<typename Type, std::size_t N>
+		void apply(matrix<Type, N, N> const& a, Type const* x, Type* y) {
+			parallel_for(N, row_grain(a), [&](std::size_t begin, std::size_t end) {
+				for (std::size_t i = begin; i < end; ++i) {
+					Type sum = Type();
+					for (std::size_t j = 0; j < N; ++j) { sum += a(i, j) * x[j]; }
+					y[i] = sum;
+				}
+			});
+		}
+
+		template<typename Type, std::size_t N>
+		void apply(csr_matrix<Type, N, N> const& a, Type const* x, Type* y) {
+			csr_multiply(a.row_offsets(), a.column_indexes(), a.values(), 1, x, y);
+		}
+
+		/* Number of chunks of `grain` elements, the last one possibly shorter, that
+		 * `parallel_sum` splits `[0, size)` into.
+		*/
+		inline std::size_t sum_chunks(std::size_t size, std::size_t grain) noexcept {
+			return size == 0 ? 1 : (size + grain - 1) / grain;
+		}
+
+		/* Sum of `function(begin, end)` over chunks of `grain` elements of `[0, size)`.
+		 * The chunks are fixed by `size` and `grain` alone and run on any thread, but
+		 * their sums are stored in the `sum_chunks(size, grain)` slots of `partials` and
+		 * added in order, so that the result is the same on every run and machine.
+		*/
+		template<typename Type, typename Function>
+		Type parallel_sum(std::size_t size, std::size_t grain, Type* partials, Function&& function) {
+			std::size_t const chunks = sum_chunks(size, grain);
+			parallel_for(chunks, 1, [&](std::size_t first, std::size_t last) {
+				for (std::size_t c = first; c < last; ++c) {
+					partials[c] = function(c * grain, std::min(size, (c + 1) * grain));
+				}
+			});
+			Type total = Type();
+			for (std::size_t c = 0; c < chunks; ++c) { total += partials[c]; }
+			return total;
+		}
+
+		template<typename Type>
+		Type dot(std::size_t n, Type const* x, Type const* y) noexcept {
+			Type sum = Type();
+			for (std::size_t i = 0; i < n; ++i) { sum += x[i] * y[i]; }
+			return sum;
+		}
+
+		/* Groups the rows of a dense matrix into colours for the relaxation sweeps. Every
+		 * row is coupled to every other, so each has a colour of its own.
+		*/
+		template<typename Type, std::size_t N>
+		void color_rows(matrix<Type, N, N> const&, iterative_workspace<Type>& workspace) {
+			workspace.order.resize(N);
+			workspace.colors.resize(N + 1);
+			for (std::size_t i = 0; i < N; ++i) { workspace.order[i] = workspace.colors[i] = i; }
+			workspace.colors[N] = N;
+		}
+
+		/* Colours the rows of a sparse matrix greedily, so that no two rows of a colour
+		 * are coupled (`a(i, j)` and `a(j, i)` are both zero), and lists them a colour at
+		 * a time: the rows of a colour can then be relaxed concurrently while giving the
+		 * same result as a sequential Gauss-Seidel sweep in that order. Stencil matrices
+		 * get the classic red-black ordering.
+		*/
+		template<typename Type, std::size_t N>
+		void color_rows(csr_matrix<Type, N, N> const& a, iterative_workspace<Type>& workspace) {
+			auto const& offsets = a.row_offsets();
+			auto const& columns = a.column_indexes();
+			std::size_t const nonzeros = a.non_zeros();
+
+			// Transposed pattern, then the colour of each row and the last row that
+			// forbade each colour.
+			auto& scratch = workspace.scratch;
+			scratch.assign(3 * N + 1 + nonzeros, 0);
+			std::size_t* const transposed_offsets = scratch.data();
+			std::size_t* const transposed_rows = transposed_offsets + N + 1;
+			std::size_t* const color = transposed_rows + nonzeros;
+			std::size_t* const forbidden = color + N;
+
+			for (std::size_t e = 0; e < nonzeros; ++e) { ++transposed_offsets[columns[e] + 1]; }
+			for (std::size_t j = 0; j < N; ++j) { transposed_offsets[j + 1] += transposed_offsets[j]; }
+			for (std::size_t i = 0; i < N; ++i) {
+				for (std::size_t e = offsets[i]; e < offsets[i + 1]; ++e) { transposed_rows[transposed_offsets[columns[e]]++] = i; }
+			}
+			for (std::size_t j = N; j > 0; --j) { transposed_offsets[j] = transposed_offsets[j - 1]; }
+			transposed_offsets[0] = 0;
+
+			std::fill(forbidden, forbidden + N, N);
+			std::size_t count = 0;
+			for (std::size_t i = 0; i < N; ++i) {
+				for (std::size_t e = offsets[i]; e < offsets[i + 1]; ++e) {
+					if (columns[e] < i) { forbidden[color[columns[e]]] = i; }
+				}
+				for (std::size_t e = transposed_offsets[i]; e < transposed_offsets[i + 1]; ++e) {
+					if (transposed_rows[e] < i) { forbidden[color[transposed_rows[e]]] = i; }
+				}
+				std::size_t c = 0;
+				while (forbidden[c] == i) { ++c; }
+				color[i] = c;
+				count = std::max(count, c + 1);
+			}
+
+			workspace.colors.assign(count + 1, 0);
+			for (std::size_t i = 0; i < N; ++i) { ++workspace.colors[color[i] + 1]; }
+			for (std::size_t c = 0; c < count; ++c) { workspace.colors[c + 1] += workspace.colors[c]; }
+			workspace.order.resize(N);
+			std::copy(workspace.colors.begin(), workspace.colors.end() - 1, forbidden);
+			for (std::size_t i = 0; i < N; ++i) { workspace.order[forbidden[color[i]]++] = i; }
+		}
+
+		/* Relaxes the rows of colour `c`, moving each by `relaxation` times the amount
+		 * that would zero its residual, and returns the sum of the squared residuals.
+		*/
+		template<typename Matrix, typename Type>
+		Type relax(Matrix const& a, Type const* b, Type* x, Type relaxation, iterative_workspace<Type>& workspace, std::size_t c) {
+			std::size_t const* const rows = workspace.order.data() + workspace.colors[c];
+			std::size_t const size = workspace.colors[c + 1] - workspace.colors[c];
+			return parallel_sum<Type>(size, row_grain(a), workspace.partials.data(), [&](std::size_t begin, std::size_t end) {
+				Type partial = Type();
+				for (std::size_t r = begin; r < end; ++r) {
+					std::size_t const i = rows[r];
+					Type diagonal;
+					Type const residual = b[i] - off_diagonal(a, i, x, diagonal) - diagonal * x[i];
+					x[i] += relaxation * residual / diagonal;
+					partial += residual * residual;
+				}
+				return partial;
+			});
+		}
+
+		/* Successive over-relaxation, with a backward sweep after each forward one when
+		 * `Symmetric`. The residual norm is accumulated while the forward sweep visits
+		 * each row, so it costs nothing, and approaches the true one as `x` converges.
+		*/
+		template<bool Symmetric, typename Matrix, typename Type, std::size_t N, typename Monitor>
+		iterative_result<Type> successive_over_relaxation(
+			Matrix const& a, vector<Type, N> const& b, vector<Type, N>& x, Type relaxation,
+			iteration_limits<Type> const& limits, iterative_workspace<Type>& workspace, Monitor& monitor
+		) {
+			color_rows(a, workspace);
+			workspace.partials.resize(sum_chunks(N, row_grain(a)));
+			std::size_t const colors = workspace.colors.size() - 1;
+			Type const norm = std::sqrt(dot(N, b.data(), b.data()));
+			Type const scale = norm == Type() ? Type(1) : norm;
+
+			iterative_result<Type> result{ 0, Type(), false };
+			while (result.iterations < limits.iterations) {
+				Type squares = Type();
+				for (std::size_t c = 0; c < colors; ++c) { squares += relax(a, b.data(), x.data(), relaxation, workspace, c); }
+				if (Symmetric) {
+					for (std::size_t c = colors; c-- > 0;) { relax(a, b.data(), x.data(), relaxation, workspace, c); }
+				}
+				result.residual = std::sqrt(squares) / scale;
+				++result.iterations;
+				result.converged = result.residual <= limits.tolerance;
+				if (!monitor(result.iterations, result.residual) || result.converged) { break; }
+			}
+			return result;
+		}
+
+	}
+
+	/* Iterative solvers of `A * x = b`, where `A` is a square dense `sor::matrix` or a
+	 * `sor::csr_matrix`, starting from the initial guess in `x`. Each can be given a
+	 * workspace, so that repeated solves don't reallocate their buffers (though large
+	 * sweeps still start threads, see `sor::iterative_workspace`), and a monitor that
+	 * is called as `monitor(iteration, residual)` after every iteration and stops the
+	 * solver by returning false.
+	*/
+
+	/* Jacobi iteration, which updates every row from the previous iterate, so all of
+	 * them concurrently. Converges if `A` is strictly diagonally dominant.
+	*/
+	template<typename Matrix, typename Type, std::size_t N, typename Monitor = detail::unmonitored>
+	iterative_result<Type> jacobi_solve(
+		Matrix const& a, vector<Type, N> const& b, vector<Type, N>& x,
+		iteration_limits<Type> const& limits, iterative_workspace<Type>& workspace, Monitor monitor = Monitor()
+	) {
+		static_assert(extent<Matrix, 0>::value == N && extent<Matrix, 1>::value == N, "the matrix must be square and match the vectors");
+		workspace.vectors.resize(N);
+		workspace.partials.resize(detail::sum_chunks(N, detail::row_grain(a)));
+		Type* const previous = workspace.vectors.data();
+		Type const norm = std::sqrt(detail::dot(N, b.data(), b.data()));
+		Type const scale = norm == Type() ? Type(1) : norm;
+
+		iterative_result<Type> result{ 0, Type(), false };
+		while (result.iterations < limits.iterations) {
+			std::copy(x.begin(), x.end(), previous);
+			Type const squares = detail::parallel_sum<Type>(N, detail::row_grain(a), workspace.partials.data(), [&](std::size_t begin, std::size_t end) {
+				Type partial = Type();
+				for (std::size_t i = begin; i < end; ++i) {
+					Type diagonal;
+					Type const off = detail::off_diagonal(a, i, previous, diagonal);
+					Type const residual = b[i] - off - diagonal * previous[i];
+					x[i] = (b[i] - off) / diagonal;
+					partial += residual * residual;
+				}
+				return partial;
+			});
+			result.residual = std::sqrt(squares) / scale;
+			++result.iterations;
+			result.converged = result.residual <= limits.tolerance;
+			if (!monitor(result.iterations, result.residual) || result.converged) { break; }
+		}
+		return result;
+	}
+
+	/* Successive over-relaxation with factor `relaxation` in `(0, 2)`, which converges
+	 * for symmetric positive definite `A`. Rows of a sparse `A` are relaxed a colour
+	 * at a time (see `detail::color_rows`), and the rows of each colour concurrently.
+	*/
+	template<typename Matrix, typename Type, std::size_t N, typename Monitor = detail::unmonitored>
+	iterative_result<Type> sor_solve(
+		Matrix const& a, vector<Type, N> const& b, vector<Type, N>& x, Type relaxation,
+		iteration_limits<Type> const& limits, iterative_workspace<Type>& workspace, Monitor monitor = Monitor()
+	) {
+		static_assert(extent<Matrix, 0>::value == N && extent<Matrix, 1>::value == N, "the matrix must be square and match the vectors");
+		return detail::successive_over_relaxation<false>(a, b, x, relaxation, limits, workspace, monitor);
+	}
+
+	/* Symmetric successive over-relaxation: a forward sweep followed by a backward one.
+	*/
+	template<typename Matrix, typename Type, std::size_t N, typename Monitor = detail::unmonitored>
+	iterative_result<Type> ssor_solve(
+		Matrix const& a, vector<Type, N> const& b, vector<Type, N>& x, Type relaxation,
+		iteration_limits<Type> const& limits, iterative_workspace<Type>& workspace, Monitor monitor = Monitor()
+	) {
+		static_assert(extent<Matrix, 0>::value == N && extent<Matrix, 1>::value == N, "the matrix must be square and match the vectors");
+		return detail::successive_over_relaxation<true>(a, b, x, relaxation, limits, workspace, monitor);
+	}
+
+	/* Gauss-Seidel iteration, which is successive over-relaxation with factor 1.
+	*/
+	template<typename Matrix, typename Type, std::size_t N, typename Monitor = detail::unmonitored>
+	iterative_result<Type> gauss_seidel_solve(
+		Matrix const& a, vector<Type, N> const& b, vector<Type, N>& x,
+		iteration_limits<Type> const& limits, iterative_workspace<Type>& workspace, Monitor monitor = Monitor()
+	) {
+		return sor_solve(a, b, x, Type(1), limits, workspace, monitor);
+	}
+
+	/* Conjugate gradient method, for symmetric positive definite `A`.
+	*/
+	template<typename Matrix, typename Type, std::size_t N, typename Monitor = detail::unmonitored>
+	iterative_result<Type> conjugate_gradient_solve(
+		Matrix const& a, vector<Type, N> const& b, vector<Type, N>& x,
+		iteration_limits<Type> const& limits, iterative_workspace<Type>& workspace, Monitor monitor = Monitor()
+	) {
+		static_assert(extent<Matrix, 0>::value == N && extent<Matrix, 1>::value == N, "the matrix must be square and match the vectors");
+		workspace.vectors.resize(3 * N);
+		Type* const r = workspace.vectors.data();
+		Type* const p = r + N;
+		Type* const q = p + N;
+		Type const norm = std::sqrt(detail::dot(N, b.data(), b.data()));
+		Type const scale = norm == Type() ? Type(1) : norm;
+
+		detail::apply(a, x.data(), q);
+		for (std::size_t i = 0; i < N; ++i) { p[i] = r[i] = b[i] - q[i]; }
+		Type squares = detail::dot(N, r, r);
+		iterative_result<Type> result{ 0, std::sqrt(squares) / scale, false };
+		result.converged = result.residual <= limits.tolerance;
+
+		while (!result.converged && result.iterations < limits.iterations) {
+			detail::apply(a, p, q);
+			Type const curvature = detail::dot(N, p, q);
+			if (curvature == Type()) { break; }
+			Type const step = squares / curvature;
+			detail::axpy(N, step, p, x.data());
+			detail::axpy(N, -step, q, r);
+			Type const next = detail::dot(N, r, r);
+			for (std::size_t i = 0; i < N; ++i) { p[i] = r[i] + (next / squares) * p[i]; }
+			squares = next;
+			result.residual = std::sqrt(squares) / scale;
+			++result.iterations;
+			result.converged = result.residual <= limits.tolerance;
+			if (!monitor(result.iterations, result.residual)) { break; }
+		}
+		return result;
+	}
+
+	/* Biconjugate gradient stabilized method, for general nonsingular `A`. Stops without
+	 * converging if the iteration breaks down.
+	*/
+	template<typename Matrix, typename Type, std::size_t N, typename Monitor = detail::unmonitored>
+	iterative_result<Type> bicgstab_solve(
+		Matrix const& a, vector<Type, N> const& b, vector<Type, N>& x,
+		iteration_limits<Type> const& limits, iterative_workspace<Type>& workspace, Monitor monitor = Monitor()
+	) {
+		static_assert(extent<Matrix, 0>::value == N && extent<Matrix, 1>::value == N, "the matrix must be square and match the vectors");
+		workspace.vectors.assign(6 * N, Type());
+		Type* const r = workspace.vectors.data();
+		Type* const shadow = r + N;
+		Type* const p = shadow + N;
+		Type* const v = p + N;
+		Type* const s = v + N;
+		Type* const t = s + N;
+		Type const norm = std::sqrt(detail::dot(N, b.data(), b.data()));
+		Type const scale = norm == Type() ? Type(1) : norm;
+
+		detail::apply(a, x.data(), v);
+		for (std::size_t i = 0; i < N; ++i) { shadow[i] = r[i] = b[i] - v[i]; }
+		std::fill(v, v + N, Type());
+		iterative_result<Type> result{ 0, std::sqrt(detail::dot(N, r, r)) / scale, false };
+		result.converged = result.residual <= limits.tolerance;
+
+		Type rho = Type(1);
+		Type alpha = Type(1);
+		Type omega = Type(1);
+		while (!result.converged && result.iterations < limits.iterations) {
+			Type const next_rho = detail::dot(N, shadow, r);
+			if (next_rho == Type()) { break; }
+			Type const beta = (next_rho / rho) * (alpha / omega);
+			rho = next_rho;
+			for (std::size_t i = 0; i < N; ++i) { p[i] = r[i] + beta * (p[i] - omega * v[i]); }
+			detail::apply(a, p, v);
+			Type const projection = detail::dot(N, shadow, v);
+			if (projection == Type()) { break; }
+			alpha = rho / projection;
+			for (std::size_t i = 0; i < N; ++i) { s[i] = r[i] - alpha * v[i]; }
+			detail::axpy(N, alpha, p, x.data());
+			++result.iterations;
+
+			Type const half = std::sqrt(detail::dot(N, s, s)) / scale;
+			if (half <= limits.tolerance) {
+				result.residual = half;
+				result.converged = true;
+				monitor(result.iterations, result.residual);
+				break;
+			}
+			detail::apply(a, s, t);
+			Type const energy = detail::dot(N, t, t);
+			omega = energy == Type() ? Type() : detail::dot(N, t, s) / energy;
+			detail::axpy(N, omega, s, x.data());
+			for (std::size_t i = 0; i < N; ++i) { r[i] = s[i] - omega * t[i]; }
+			result.residual = std::sqrt(detail::dot(N, r, r)) / scale;
+			result.converged = result.residual <= limits.tolerance;
+			if (omega == Type() || !monitor(result.iterations, result.residual)) { break; }
+		}
+		return result;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+#include "../vector.hpp"
+#include "../matrix.hpp"
+#include "../detail/gemm.hpp"
+#include "../detail/triangular.hpp"
+
+namespace sor {
+
+	/* Result of `lu_decompose`: `P * A = L * U`, where `L` is unit lower triangular,
+	 * `U` is upper triangular and `P` is a row permutation.
+	 * `lu` holds `U` on and above the diagonal and `L` below it, row `i` of `P * A` is
+	 * row `permutation[i]` of `A` and `sign` is the determinant of `P`. A decomposition
+	 * is `singular` if a column had no nonzero pivot, in which case it can't be used
+	 * to solve systems.
+	*/
+	template<typename Type, std::size_t N>
+	struct lu_decomposition {
+		matrix<Type, N, N> lu;
+		vector<std::size_t, N> permutation;
+		int sign;
+		bool singular;
+	};
+
+	/* Implementation details.
+	*/
+	namespace detail {
+
+		/* Matrices up to this order are factorized with every column unrolled at compile
+		 * time, larger ones are factorized a panel of `lu_block` columns at a time.
+		*/
+		constexpr std::size_t lu_unrolled = 4;
+		constexpr std::size_t lu_block = 32;
+
+		/* Eliminates column `j` of the `n` x `n` row major matrix `a` below the diagonal,
+		 * updating the columns up to `end`. The row with the largest element in the
+		 * column is swapped with row `j` first. Returns false, leaving the column as it
+		 * is, if the column has no nonzero pivot.
+		*/
+		template<typename Type>
+		bool lu_eliminate(Type* a, std::size_t n, std::size_t j, std::size_t end, std::size_t* permutation, int& sign) {
+			std::size_t pivot = j;
+			auto largest = std::abs(a[j * n + j]);
+			for (std::size_t i = j + 1; i < n; ++i) {
+				auto const magnitude = std::abs(a[i * n + j]);
+				if (magnitude > largest) {
+					largest = magnitude;
+					pivot = i;
+				}
+			}
+			if (largest == decltype(largest)()) { return false; }
+
+			if (pivot != j) {
+				for (std::size_t c = 0; c < n; ++c) { std::swap(a[j * n + c], a[pivot * n + c]); }
+				std::swap(permutation[j], permutation[pivot]);
+				sign = -sign;
+			}
+
+			Type const* row = a + j * n;
+			for (std::size_t i = j + 1; i < n; ++i) {
+				Type* other = a + i * n;
+				Type const factor = other[j] /= row[j];
+				for (std::size_t c = j + 1; c < end; ++c) { other[c] -= factor * row[c]; }
+			}
+			return true;
+		}
+
+		template<std::size_t N, typename Type, std::size_t... J>
+		bool lu_factorize(Type* a, std::size_t* permutation, int& sign, std::index_sequence<J...>) {
+			bool regular = true;
+			((regular = lu_eliminate(a, N, J, N, permutation, sign) && regular), ...);
+			return regular;
+		}
+
+		/* Right looking blocked factorization: each panel is eliminated column by column,
+		 * then the rows of `U` to its right are solved for and the trailing submatrix is
+		 * updated with a single matrix multiplication.
+		*/
+		template<std::size_t N, typename Type>
+		bool lu_factorize(Type* a, std::size_t* permutation, int& sign) {
+			if constexpr (N <= lu_unrolled) {
+				return lu_factorize<N>(a, permutation, sign, std::make_index_sequence<N>());
+			} else {
+				bool regular = true;
+				for (std::size_t kk = 0; kk < N; kk += lu_block) {
+					std::size_t const end = (N - kk < lu_block) ? N : kk + lu_block;
+					for (std::size_t j = kk; j < end; ++j) {
+						regular = lu_eliminate(a, N, j, end, permutation, sign) && regular;
+					}
+					if (end < N) {
+						solve_lower<true>(end - kk, N - end, a + kk * N + kk, N, a + kk * N + end, N);
+						gemm(N - end, N - end, end - kk, Type(-1),
+							a + end * N + kk, N,
+							a + kk * N + end, N,
+							a + end * N + end, N);
+					}
+				}
+				return regular;
+			}
+		}
+
+		/* Solves `A * X = B` in place for the `N` x `K` row major `x`, which initially
+		 * holds `P * B`.
+		*/
+		template<std::size_t N, typename Type>
+		void lu_substitute(lu_decomposition<Type, N> const& decomposition, Type* x, std::size_t k) {
+			assert(!decomposition.singular);
+			solve_lower<true>(N, k, decomposition.lu.data(), N, x, k);
+			solve_upper<false>(N, k, decomposition.lu.data(), N, x, k);
+		}
+
+	}
+
+	/* LU decomposition with partial pivoting.
+	 * Example:
+	 * 		sor::matrix<double, 3, 3> a({ ... });
+	 * 		auto lu = sor::lu_decompose(a);
+	 * 		auto x = sor::solve(lu, b); // same as sor::solve(a, b)
+	*/
+	template<typename Type, std::size_t N>
+	lu_decomposition<Type, N> lu_decompose(matrix<Type, N, N> const& input) {
+		static_assert(std::is_floating_point<Type>::value, "LU decomposition requires floating point elements");
+		lu_decomposition<Type, N> result{ input, {}, 1, false };
+		for (std::size_t i = 0; i < N; ++i) { result.permutation[i] = i; }
+		result.singular = !detail::lu_factorize<N>(result.lu.data(), result.permutation.data(), result.sign);
+		return result;
+	}
+
+	/* Solves `A * x = b`, given the decomposition of `A`, which must not be singular.
+	*/
+	template<typename Type, std::size_t N>
+	vector<Type, N> solve(lu_decomposition<Type, N> const& decomposition, vector<Type, N> const& b) {
+		vector<Type, N> x;
+		for (std::size_t i = 0; i < N; ++i) { x[i] = b[decomposition.permutation[i]]; }
+		detail::lu_substitute(decomposition, x.data(), 1);
+		return x;
+	}
+
+	/* Solves `A * X = B` for every column of `B` at once.
+	*/
+	template<typename Type, std::size_t N, std::size_t K>
+	matrix<Type, N, K> solve(lu_decomposition<Type, N> const& decomposition, matrix<Type, N, K> const& b) {
+		matrix<Type, N, K> x;
+		for (std::size_t i = 0; i < N; ++i) {
+			Type const* row = b.data() + decomposition.permutation[i] * K;
+			for (std::size_t c = 0; c < K; ++c) { x(i, c) = row[c]; }
+		}
+		detail::lu_substitute(decomposition, x.data(), K);
+		return x;
+	}
+
+	/* Solves `A * x = b`, where `A` must not be singular.
+	*/
+	template<typename Type, std::size_t N>
+	vector<Type, N> solve(matrix<Type, N, N> const& a, vector<Type, N> const& b) {
+		return solve(lu_decompose(a), b);
+	}
+
+	template<typename Type, std::size_t N, std::size_t K>
+	matrix<Type, N, K> solve(matrix<Type, N, N> const& a, matrix<Type, N, K> const& b) {
+		return solve(lu_decompose(a), b);
+	}
+
+	/* Determinant of the decomposed matrix.
+	*/
+	template<typename Type, std::size_t N>
+	Type determinant(lu_decomposition<Type, N> const& decomposition) {
+		if (decomposition.singular) { return Type(); }
+		Type result = Type(decomposition.sign);
+		for (std::size_t i = 0; i < N; ++i) { result *= decomposition.lu(i, i); }
+		return result;
+	}
+
+	/* Determinant.
+	 * Note: Matrices up to 3 x 3 use the explicit formula, larger ones are decomposed.
+	*/
+	template<typename Type, std::size_t N>
+	Type determinant(matrix<Type, N, N> const& a) {
+		if constexpr (N == 0) {
+			return Type(1);
+		} else if constexpr (N == 1) {
+			return a(0, 0);
+		} else if constexpr (N == 2) {
+			return a(0, 0) * a(1, 1) - a(0, 1) * a(1, 0);
+		} else if constexpr (N == 3) {
+			return a(0, 0) * (a(1, 1) * a(2, 2) - a(1, 2) * a(2, 1))
+				- a(0, 1) * (a(1, 0) * a(2, 2) - a(1, 2) * a(2, 0))
+				+ a(0, 2) * (a(1, 0) * a(2, 1) - a(1, 1) * a(2, 0));
+		} else {
+			return determinant(lu_decompose(a));
+		}
+	}
+
+	/* Inverse of a matrix, which must not be singular.
+	*/
+	template<typename Type, std::size_t N>
+	matrix<Type, N, N> inverse(matrix<Type, N, N> const& a) {
+		matrix<Type, N, N> identity{};
+		for (std::size_t i = 0; i < N; ++i) { identity(i, i) = Type(1); }
+		return solve(lu_decompose(a), identity);
+	}
+
+}
\ No newline at end of file
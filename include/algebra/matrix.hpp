@@ -1,21 +1,57 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
 #include <type_traits>
 
+#include "../vector.hpp"
 #include "../matrix.hpp"
+#include "../detail/axpy.hpp"
+#include "../detail/constexpr.hpp"
+#include "../detail/gemm.hpp"
+#include "../detail/parallel.hpp"
 
 namespace sor {
 
+	/* Implementation details.
+	*/
+	namespace detail {
+
+		/* Minimum number of elements updated by each thread in a rank one update.
+		*/
+		constexpr std::size_t rank_one_grain = std::size_t(1) << 15;
+
+	}
+
 	/* Matrix multiplication.
+	 * Note: Outside of constant expressions this runs through the cache blocked
+	 * `detail::gemm` kernel, accumulating in the `sor::accumulation_type` of the
+	 * result. Integer sums are exact, so products of narrow integers are matrices of
+	 * their accumulation type; those of 8 bit integers run through the dot product
+	 * kernel `detail::gemm_int8`.
 	*/
 	template<typename LhsType, typename RhsType, std::size_t M, std::size_t N, std::size_t P>
-	auto operator*(matrix<LhsType, M, N>& lhs, matrix<RhsType, N, P> const& rhs) {
+	constexpr auto operator*(matrix<LhsType, M, N> const& lhs, matrix<RhsType, N, P> const& rhs) {
 		using common_type = typename std::common_type<LhsType, RhsType>::type;
-		using result_type = matrix<common_type, M, P>;
-		result_type result;
+		using accumulator = typename accumulation_type<common_type>::type;
+		using value_type = typename std::conditional<
+			std::is_integral<common_type>::value, accumulator, common_type
+		>::type;
+		using result_type = matrix<value_type, M, P>;
+		result_type result{};
+		if (!detail::is_constant_evaluated()) {
+			if constexpr (std::is_integral<LhsType>::value && std::is_integral<RhsType>::value && sizeof(LhsType) == 1 && sizeof(RhsType) == 1) {
+				detail::gemm_int8(M, P, N, lhs.data(), rhs.data(), result.data());
+			} else if constexpr (std::is_same<accumulator, value_type>::value) {
+				detail::gemm(M, P, N, value_type(1), lhs.data(), N, rhs.data(), P, result.data(), P);
+			} else {
+				detail::gemm_widened<accumulator>(M, P, N, lhs.data(), rhs.data(), result.data());
+			}
+			return result;
+		}
 		for (std::size_t m = 0; m < M; ++m) {
 			for (std::size_t p = 0; p < P; ++p) {
-				result(m, p) = common_type();
+				result(m, p) = value_type();
 				for (std::size_t n = 0; n < N; ++n) {
 					result(m, p) += (lhs(m, n) * rhs(n, p));
 				}
@@ -24,4 +60,50 @@ namespace sor {
 		return result;
 	}
 
+	/* Outer product `x * y^T`, the `M` x `N` matrix whose rows are the elements of
+	 * `lhs` times `rhs`; each row is a single contiguous scaled copy.
+	*/
+	template<typename LhsType, typename RhsType, std::size_t M, std::size_t N>
+	constexpr auto outer_product(vector<LhsType, M> const& lhs, vector<RhsType, N> const& rhs) {
+		using common_type = typename std::common_type<LhsType, RhsType>::type;
+		matrix<common_type, M, N> result{};
+		for (std::size_t i = 0; i < M; ++i) {
+			common_type const factor = lhs[i];
+			for (std::size_t j = 0; j < N; ++j) { result(i, j) = factor * rhs[j]; }
+		}
+		return result;
+	}
+
+	/* Kronecker product: the `M * P` x `N * Q` block matrix whose block `(i, j)` is
+	 * `lhs(i, j) * rhs`. It is filled a row of the result at a time, as scaled copies
+	 * of the rows of `rhs`, so that every write is contiguous.
+	*/
+	template<typename LhsType, typename RhsType, std::size_t M, std::size_t N, std::size_t P, std::size_t Q>
+	constexpr auto kronecker(matrix<LhsType, M, N> const& lhs, matrix<RhsType, P, Q> const& rhs) {
+		using common_type = typename std::common_type<LhsType, RhsType>::type;
+		matrix<common_type, M * P, N * Q> result{};
+		for (std::size_t i = 0; i < M; ++i) {
+			for (std::size_t p = 0; p < P; ++p) {
+				for (std::size_t j = 0; j < N; ++j) {
+					common_type const factor = lhs(i, j);
+					for (std::size_t q = 0; q < Q; ++q) { result(i * P + p, j * Q + q) = factor * rhs(p, q); }
+				}
+			}
+		}
+		return result;
+	}
+
+	/* Rank one update `a += alpha * x * y^T`, without forming the outer product: each
+	 * row of `a` gets `alpha * x[i]` times `y` added in a single pass. Rows are split
+	 * between threads for large matrices.
+	*/
+	template<typename Type, typename XType, typename YType, std::size_t M, std::size_t N>
+	void rank_one_update(matrix<Type, M, N>& a, Type const& alpha, vector<XType, M> const& x, vector<YType, N> const& y) {
+		Type* const data = a.data();
+		std::size_t const grain = std::max<std::size_t>(1, detail::rank_one_grain / (N + 1));
+		detail::parallel_for(M, grain, [&](std::size_t begin, std::size_t end) {
+			for (std::size_t i = begin; i < end; ++i) { detail::axpy(N, Type(alpha * x[i]), y.data(), data + i * N); }
+		});
+	}
+
 }
\ No newline at end of file
@@ -0,0 +1,242 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "../vector.hpp"
+#include "../matrix.hpp"
+#include "../packed_matrix.hpp"
+#include "../detail/axpy.hpp"
+
+namespace sor {
+
+	/* Implementation details.
+	*/
+	namespace detail {
+
+		/* `c += A * b`, where `A` is the `n` x `n` packed matrix stored in `a` and `b` and
+		 * `c` are `n` x `k` row major matrices. Only the stored elements of `A` are
+		 * visited, a packed row at a time; each element of a symmetric matrix below the
+		 * diagonal also stands in for its mirror image.
+		*/
+		template<typename Packing, typename AType, typename BType, typename CType>
+		void packed_multiply(std::size_t n, std::size_t k, AType const* a, BType const* b, CType* c) {
+			for (std::size_t i = 0; i < n; ++i) {
+				CType* const out = c + i * k;
+				if constexpr (std::is_same<Packing, diagonal_packing>::value) {
+					axpy(k, a[i], b + i * k, out);
+				} else if constexpr (std::is_same<Packing, upper_packing>::value) {
+					AType const* const row = a + Packing::index(n, i, i);
+					for (std::size_t j = i; j < n; ++j) { axpy(k, row[j - i], b + j * k, out); }
+				} else {
+					AType const* const row = a + Packing::index(n, i, 0);
+					for (std::size_t j = 0; j < i; ++j) {
+						axpy(k, row[j], b + j * k, out);
+						if constexpr (std::is_same<Packing, symmetric_packing>::value) {
+							axpy(k, row[j], b + i * k, c + j * k);
+						}
+					}
+					axpy(k, row[i], b + i * k, out);
+				}
+			}
+		}
+
+		/* Solves `A * X = B` in place for the `n` x `k` row major `x`, which holds `B`,
+		 * where `A` is a triangular or diagonal packed matrix stored in `a`.
+		*/
+		template<typename Packing, typename AType, typename XType>
+		void packed_solve(std::size_t n, std::size_t k, AType const* a, XType* x) {
+			if constexpr (std::is_same<Packing, diagonal_packing>::value) {
+				for (std::size_t i = 0; i < n; ++i) {
+					for (std::size_t c = 0; c < k; ++c) { x[i * k + c] /= a[i]; }
+				}
+			} else if constexpr (std::is_same<Packing, lower_packing>::value) {
+				for (std::size_t i = 0; i < n; ++i) {
+					AType const* const row = a + Packing::index(n, i, 0);
+					XType* const out = x + i * k;
+					for (std::size_t j = 0; j < i; ++j) { axpy(k, -row[j], x + j * k, out); }
+					for (std::size_t c = 0; c < k; ++c) { out[c] /= row[i]; }
+				}
+			} else {
+				static_assert(std::is_same<Packing, upper_packing>::value, "only triangular and diagonal matrices can be solved by substitution");
+				for (std::size_t i = n; i-- > 0;) {
+					AType const* const row = a + Packing::index(n, i, i);
+					XType* const out = x + i * k;
+					for (std::size_t j = i + 1; j < n; ++j) { axpy(k, -row[j - i], x + j * k, out); }
+					for (std::size_t c = 0; c < k; ++c) { out[c] /= row[0]; }
+				}
+			}
+		}
+
+		/* Solves `L^T * X = B` in place for `x`, which holds `B`, where `L` is the packed
+		 * lower triangular matrix stored in `l`, reading it a row at a time.
+		*/
+		template<typename LType, typename XType>
+		void packed_solve_transposed(std::size_t n, std::size_t k, LType const* l, XType* x) {
+			for (std::size_t j = n; j-- > 0;) {
+				LType const* const row = l + lower_packing::index(n, j, 0);
+				XType* const solved = x + j * k;
+				for (std::size_t c = 0; c < k; ++c) { solved[c] /= row[j]; }
+				for (std::size_t i = 0; i < j; ++i) { axpy(k, -row[i], solved, x + i * k); }
+			}
+		}
+
+		/* Replaces the packed lower triangle of a symmetric matrix with its Cholesky
+		 * factor. Both rows involved in each element are contiguous in the packed layout.
+		 * Returns false if the matrix isn't positive definite.
+		*/
+		template<typename Type>
+		bool packed_cholesky(std::size_t n, Type* a) {
+			for (std::size_t i = 0; i < n; ++i) {
+				Type* const row = a + lower_packing::index(n, i, 0);
+				for (std::size_t j = 0; j <= i; ++j) {
+					Type const* const other = a + lower_packing::index(n, j, 0);
+					Type sum = row[j];
+					for (std::size_t p = 0; p < j; ++p) { sum -= row[p] * other[p]; }
+					if (j < i) {
+						row[j] = sum / other[j];
+					} else if (sum > Type()) {
+						row[i] = std::sqrt(sum);
+					} else {
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+
+		/* Solves `A * X = B` in place for the `N` x `k` row major `x`, which holds `B`,
+		 * where `A` is a packed matrix stored in `a`; symmetric matrices are decomposed
+		 * first. Returns false, leaving `x` untouched, if a symmetric `A` isn't positive
+		 * definite.
+		*/
+		template<typename Packing, std::size_t N, typename Type>
+		bool packed_solve_system(Type const* a, Type* x, std::size_t k) {
+			if constexpr (std::is_same<Packing, symmetric_packing>::value) {
+				std::array<Type, lower_packing::size(N)> factor;
+				for (std::size_t i = 0; i < factor.size(); ++i) { factor[i] = a[i]; }
+				if (!packed_cholesky(N, factor.data())) { return false; }
+				packed_solve<lower_packing>(N, k, factor.data(), x);
+				packed_solve_transposed(N, k, factor.data(), x);
+			} else {
+				packed_solve<Packing>(N, k, a, x);
+			}
+			return true;
+		}
+
+	}
+
+	/* Matrix vector multiplication, visiting only the stored elements of the matrix.
+	*/
+	template<typename LhsType, typename RhsType, std::size_t N, typename Packing>
+	auto operator*(packed_matrix<LhsType, N, Packing> const& lhs, vector<RhsType, N> const& rhs) {
+		using common_type = typename std::common_type<LhsType, RhsType>::type;
+		vector<common_type, N> result{};
+		detail::packed_multiply<Packing>(N, 1, lhs.data(), rhs.data(), result.data());
+		return result;
+	}
+
+	/* Multiplication of a packed matrix by a dense one.
+	*/
+	template<typename LhsType, typename RhsType, std::size_t N, std::size_t K, typename Packing>
+	auto operator*(packed_matrix<LhsType, N, Packing> const& lhs, matrix<RhsType, N, K> const& rhs) {
+		using common_type = typename std::common_type<LhsType, RhsType>::type;
+		matrix<common_type, N, K> result{};
+		detail::packed_multiply<Packing>(N, K, lhs.data(), rhs.data(), result.data());
+		return result;
+	}
+
+	/* Multiplication of a dense matrix by a diagonal one, which scales its columns.
+	*/
+	template<typename LhsType, typename RhsType, std::size_t M, std::size_t N>
+	auto operator*(matrix<LhsType, M, N> const& lhs, diagonal_matrix<RhsType, N> const& rhs) {
+		using common_type = typename std::common_type<LhsType, RhsType>::type;
+		matrix<common_type, M, N> result;
+		for (std::size_t i = 0; i < M; ++i) {
+			for (std::size_t j = 0; j < N; ++j) { result(i, j) = lhs(i, j) * rhs.data()[j]; }
+		}
+		return result;
+	}
+
+	/* Products of triangular matrices of the same kind, and of diagonal matrices, which
+	 * keep their structure.
+	*/
+	template<typename LhsType, typename RhsType, std::size_t N>
+	auto operator*(lower_triangular<LhsType, N> const& lhs, lower_triangular<RhsType, N> const& rhs) {
+		using common_type = typename std::common_type<LhsType, RhsType>::type;
+		using packing = detail::lower_packing;
+		lower_triangular<common_type, N> result{};
+		for (std::size_t i = 0; i < N; ++i) {
+			LhsType const* const row = lhs.data() + packing::index(N, i, 0);
+			common_type* const out = result.data() + packing::index(N, i, 0);
+			for (std::size_t p = 0; p <= i; ++p) {
+				detail::axpy(p + 1, row[p], rhs.data() + packing::index(N, p, 0), out);
+			}
+		}
+		return result;
+	}
+
+	template<typename LhsType, typename RhsType, std::size_t N>
+	auto operator*(upper_triangular<LhsType, N> const& lhs, upper_triangular<RhsType, N> const& rhs) {
+		using common_type = typename std::common_type<LhsType, RhsType>::type;
+		using packing = detail::upper_packing;
+		upper_triangular<common_type, N> result{};
+		for (std::size_t i = 0; i < N; ++i) {
+			LhsType const* const row = lhs.data() + packing::index(N, i, i);
+			common_type* const out = result.data() + packing::index(N, i, i);
+			for (std::size_t p = i; p < N; ++p) {
+				detail::axpy(N - p, row[p - i], rhs.data() + packing::index(N, p, p), out + (p - i));
+			}
+		}
+		return result;
+	}
+
+	template<typename LhsType, typename RhsType, std::size_t N>
+	auto operator*(diagonal_matrix<LhsType, N> const& lhs, diagonal_matrix<RhsType, N> const& rhs) {
+		using common_type = typename std::common_type<LhsType, RhsType>::type;
+		diagonal_matrix<common_type, N> result;
+		for (std::size_t i = 0; i < N; ++i) { result.data()[i] = lhs.data()[i] * rhs.data()[i]; }
+		return result;
+	}
+
+	/* In place solution of `A * x = b`, replacing `b` with `x`. Triangular and diagonal
+	 * `A` are solved by substitution, and must have no zeros on the diagonal. Symmetric
+	 * `A` are solved through the Cholesky decomposition of their packed lower triangle;
+	 * returns false, leaving `b` unchanged, if a symmetric `A` isn't positive definite.
+	*/
+	template<typename Type, std::size_t N, typename Packing>
+	bool solve_in_place(packed_matrix<Type, N, Packing> const& a, vector<Type, N>& b) {
+		return detail::packed_solve_system<Packing, N>(a.data(), b.data(), 1);
+	}
+
+	template<typename Type, std::size_t N, std::size_t K, typename Packing>
+	bool solve_in_place(packed_matrix<Type, N, Packing> const& a, matrix<Type, N, K>& b) {
+		return detail::packed_solve_system<Packing, N>(a.data(), b.data(), K);
+	}
+
+	/* Solves `A * x = b`, as `solve_in_place` does. If a symmetric `A` isn't positive
+	 * definite every element of the result is a quiet NaN, rather than a solution to
+	 * some other system.
+	*/
+	template<typename Type, std::size_t N, typename Packing>
+	vector<Type, N> solve(packed_matrix<Type, N, Packing> const& a, vector<Type, N> const& b) {
+		vector<Type, N> x(b);
+		if (!solve_in_place(a, x)) {
+			for (std::size_t i = 0; i < N; ++i) { x[i] = std::numeric_limits<Type>::quiet_NaN(); }
+		}
+		return x;
+	}
+
+	template<typename Type, std::size_t N, std::size_t K, typename Packing>
+	matrix<Type, N, K> solve(packed_matrix<Type, N, Packing> const& a, matrix<Type, N, K> const& b) {
+		matrix<Type, N, K> x(b);
+		if (!solve_in_place(a, x)) {
+			for (std::size_t i = 0; i < N * K; ++i) { x.data()[i] = std::numeric_limits<Type>::quiet_NaN(); }
+		}
+		return x;
+	}
+
+}
\ No newline at end of file
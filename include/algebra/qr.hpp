@@ -0,0 +1,314 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include <type_traits>
+
+#include "../vector.hpp"
+#include "../matrix.hpp"
+#include "../detail/gemm.hpp"
+#include "../detail/parallel.hpp"
+#include "../detail/triangular.hpp"
+
+namespace sor {
+
+	/* Result of `qr_decompose`: `A = Q * R`, where `Q = H_0 * ... * H_(N - 1)` is the
+	 * product of Householder reflections `H_j = I - tau[j] * v_j * v_j^T`.
+	 * `qr` holds the upper triangular `R` on and above the diagonal and each `v_j`
+	 * below it, in column `j`, without its leading element, which is always one.
+	*/
+	template<typename Type, std::size_t M, std::size_t N>
+	struct qr_decomposition {
+		matrix<Type, M, N> qr;
+		vector<Type, N> tau;
+	};
+
+	/* Implementation details.
+	*/
+	namespace detail {
+
+		/* Number of columns in the panels of the blocked QR decomposition.
+		*/
+		constexpr std::size_t qr_block = 32;
+
+		/* Least squares problems with at least twice as many rows as this, and at least
+		 * four times as many rows as columns, are split into blocks of rows by TSQR.
+		*/
+		constexpr std::size_t tsqr_rows = 512;
+
+		/* Replaces the `rows` elements of the column starting at `x`, `ldx` apart, with
+		 * the Householder vector that reflects it onto its first axis, storing the norm
+		 * of the column with the sign opposite to its first element in place of the
+		 * leading one. Returns the `tau` of the reflection, which is zero if the column
+		 * is already on its first axis.
+		*/
+		template<typename Type>
+		Type householder(Type* x, std::size_t ldx, std::size_t rows) {
+			Type sigma = Type();
+			for (std::size_t i = 1; i < rows; ++i) { sigma += x[i * ldx] * x[i * ldx]; }
+			if (sigma == Type()) { return Type(); }
+			Type const alpha = x[0];
+			Type const beta = -std::copysign(std::sqrt(alpha * alpha + sigma), alpha);
+			Type const scale = Type(1) / (alpha - beta);
+			for (std::size_t i = 1; i < rows; ++i) { x[i * ldx] *= scale; }
+			x[0] = beta;
+			return (beta - alpha) / beta;
+		}
+
+		/* Applies the reflection with Householder vector `v` (whose elements are `ldv`
+		 * apart) to the `rows` x `k` row major block `x`. `work` must hold `k` elements.
+		*/
+		template<typename Type>
+		void apply_householder(
+			Type const* v, std::size_t ldv, Type tau, std::size_t rows,
+			Type* x, std::size_t ldx, std::size_t k, Type* work
+		) {
+			if (tau == Type()) { return; }
+			for (std::size_t c = 0; c < k; ++c) { work[c] = x[c]; }
+			for (std::size_t i = 1; i < rows; ++i) {
+				Type const element = v[i * ldv];
+				Type const* row = x + i * ldx;
+				for (std::size_t c = 0; c < k; ++c) { work[c] += element * row[c]; }
+			}
+			for (std::size_t c = 0; c < k; ++c) {
+				work[c] *= tau;
+				x[c] -= work[c];
+			}
+			for (std::size_t i = 1; i < rows; ++i) {
+				Type const element = v[i * ldv];
+				Type* row = x + i * ldx;
+				for (std::size_t c = 0; c < k; ++c) { row[c] -= element * work[c]; }
+			}
+		}
+
+		/* Number of elements of the workspace of `householder_qr`.
+		*/
+		inline std::size_t householder_qr_workspace(std::size_t m, std::size_t n) noexcept {
+			return 2 * m * qr_block + qr_block * qr_block + qr_block * n + n;
+		}
+
+		/* Householder QR decomposition of the `m` x `n` row major `a`, with `m >= n`, in
+		 * the layout of `qr_decomposition`.
+		 * Each panel of `qr_block` columns is factorized a reflection at a time. The
+		 * reflections of the panel are then accumulated in the compact WY form
+		 * `I - V * T * V^T`, with `T` upper triangular, so that they are applied to the
+		 * columns to the right of the panel by two matrix multiplications.
+		*/
+		template<typename Type>
+		void householder_qr(Type* a, std::size_t m, std::size_t n, std::size_t lda, Type* tau, Type* workspace) {
+			Type* const v = workspace;
+			Type* const vt = v + m * qr_block;
+			Type* const t = vt + m * qr_block;
+			Type* const w = t + qr_block * qr_block;
+			Type* const work = w + qr_block * n;
+
+			for (std::size_t kk = 0; kk < n; kk += qr_block) {
+				std::size_t const end = (n - kk < qr_block) ? n : kk + qr_block;
+				std::size_t const nb = end - kk;
+				std::size_t const rows = m - kk;
+				Type* const panel = a + kk * lda + kk;
+
+				for (std::size_t j = 0; j < nb; ++j) {
+					Type* const column = panel + j * lda + j;
+					tau[kk + j] = householder(column, lda, rows - j);
+					apply_householder(column, lda, tau[kk + j], rows - j, column + 1, lda, nb - j - 1, work);
+				}
+				if (end == n) { break; }
+
+				// The Householder vectors of the panel, explicitly and transposed.
+				for (std::size_t p = 0; p < rows; ++p) {
+					for (std::size_t q = 0; q < nb; ++q) {
+						Type const element = p < q ? Type() : p == q ? Type(1) : panel[p * lda + q];
+						v[p * nb + q] = element;
+						vt[q * rows + p] = element;
+					}
+				}
+
+				// T(0:q, q) = -tau[q] * T(0:q, 0:q) * V(:, 0:q)^T * v_q
+				for (std::size_t q = 0; q < nb; ++q) {
+					Type const scale = tau[kk + q];
+					for (std::size_t r = 0; r < q; ++r) {
+						Type product = Type();
+						for (std::size_t p = q; p < rows; ++p) { product += vt[r * rows + p] * vt[q * rows + p]; }
+						work[r] = product;
+					}
+					for (std::size_t r = 0; r < q; ++r) {
+						Type sum = Type();
+						for (std::size_t s = r; s < q; ++s) { sum += t[r * nb + s] * work[s]; }
+						t[r * nb + q] = -scale * sum;
+					}
+					t[q * nb + q] = scale;
+				}
+
+				// A2 -= V * T^T * V^T * A2
+				std::size_t const columns = n - end;
+				Type* const trailing = a + kk * lda + end;
+				for (std::size_t i = 0; i < nb * columns; ++i) { w[i] = Type(); }
+				gemm(nb, columns, rows, Type(1), vt, rows, trailing, lda, w, columns);
+				for (std::size_t i = nb; i-- > 0;) {
+					Type* const row = w + i * columns;
+					for (std::size_t c = 0; c < columns; ++c) { row[c] *= t[i * nb + i]; }
+					for (std::size_t j = 0; j < i; ++j) {
+						Type const factor = t[j * nb + i];
+						Type const* other = w + j * columns;
+						for (std::size_t c = 0; c < columns; ++c) { row[c] += factor * other[c]; }
+					}
+				}
+				gemm(rows, columns, nb, Type(-1), v, nb, w, columns, trailing, lda);
+			}
+		}
+
+		template<typename Type>
+		void householder_qr(Type* a, std::size_t m, std::size_t n, std::size_t lda, Type* tau) {
+			std::vector<Type> workspace(householder_qr_workspace(m, n));
+			householder_qr(a, m, n, lda, tau, workspace.data());
+		}
+
+		/* Stores the first `n` columns of `Q` in the `m` x `n` row major `q`, given the
+		 * decomposition of an `m` x `n` matrix in the layout of `householder_qr`.
+		 * `work` must hold `n` elements.
+		*/
+		template<typename Type>
+		void householder_q(
+			Type const* a, std::size_t m, std::size_t n, std::size_t lda, Type const* tau,
+			Type* q, Type* work
+		) {
+			for (std::size_t i = 0; i < m * n; ++i) { q[i] = Type(); }
+			for (std::size_t i = 0; i < n; ++i) { q[i * n + i] = Type(1); }
+			for (std::size_t j = n; j-- > 0;) {
+				apply_householder(a + j * lda + j, lda, tau[j], m - j, q + j * n, n, n, work);
+			}
+		}
+
+		/* Replaces the `m` x `k` row major `x` with `Q^T * x`, given the decomposition
+		 * of an `m` x `n` matrix in the layout of `householder_qr`.
+		*/
+		template<typename Type>
+		void apply_qt(
+			Type const* a, std::size_t m, std::size_t n, std::size_t lda, Type const* tau,
+			Type* x, std::size_t k, std::size_t ldx
+		) {
+			std::vector<Type> work(k);
+			for (std::size_t j = 0; j < n; ++j) {
+				apply_householder(a + j * lda + j, lda, tau[j], m - j, x + j * ldx, ldx, k, work.data());
+			}
+		}
+
+		/* Least squares solution of the `m` x `n` system `a * x = b` with `k` right hand
+		 * sides, overwriting `a` and `b`. The solution is left in the first `n` rows of
+		 * `b`.
+		 * Tall and skinny systems are solved by TSQR: blocks of rows are decomposed in
+		 * parallel, then their stacked `R` factors are decomposed once more.
+		*/
+		template<typename Type>
+		void least_squares(Type* a, Type* b, std::size_t m, std::size_t n, std::size_t k) {
+			std::size_t const rows = n * 2 > tsqr_rows ? n * 2 : tsqr_rows;
+			std::size_t const blocks = m / rows;
+			if (blocks < 2 || m < n * 4) {
+				std::vector<Type> tau(n);
+				householder_qr(a, m, n, n, tau.data());
+				apply_qt(a, m, n, n, tau.data(), b, k, k);
+				solve_upper<false>(n, k, a, n, b, k);
+				return;
+			}
+
+			std::vector<Type> tau(blocks * n);
+			parallel_for(blocks, 1, [&](std::size_t first, std::size_t last) {
+				for (std::size_t block = first; block < last; ++block) {
+					std::size_t const begin = m * block / blocks;
+					std::size_t const height = m * (block + 1) / blocks - begin;
+					householder_qr(a + begin * n, height, n, n, tau.data() + block * n);
+					apply_qt(a + begin * n, height, n, n, tau.data() + block * n, b + begin * k, k, k);
+				}
+			});
+
+			std::size_t const stacked = blocks * n;
+			std::vector<Type> r(stacked * n), c(stacked * k), top(n);
+			for (std::size_t block = 0; block < blocks; ++block) {
+				std::size_t const begin = m * block / blocks;
+				for (std::size_t i = 0; i < n; ++i) {
+					for (std::size_t j = i; j < n; ++j) { r[(block * n + i) * n + j] = a[(begin + i) * n + j]; }
+					for (std::size_t j = 0; j < k; ++j) { c[(block * n + i) * k + j] = b[(begin + i) * k + j]; }
+				}
+			}
+			householder_qr(r.data(), stacked, n, n, top.data());
+			apply_qt(r.data(), stacked, n, n, top.data(), c.data(), k, k);
+			solve_upper<false>(n, k, r.data(), n, c.data(), k);
+			for (std::size_t i = 0; i < n * k; ++i) { b[i] = c[i]; }
+		}
+
+	}
+
+	/* Householder QR decomposition of a matrix with at least as many rows as columns.
+	 * Example:
+	 * 		sor::matrix<double, 100, 3> a;
+	 * 		auto qr = sor::qr_decompose(a);
+	 * 		auto q = sor::q_factor(qr); // sor::matrix<double, 100, 3>
+	 * 		auto r = sor::r_factor(qr); // sor::matrix<double, 3, 3>
+	*/
+	template<typename Type, std::size_t M, std::size_t N>
+	qr_decomposition<Type, M, N> qr_decompose(matrix<Type, M, N> const& a) {
+		static_assert(std::is_floating_point<Type>::value, "QR decomposition requires floating point elements");
+		static_assert(M >= N, "QR decomposition requires at least as many rows as columns");
+		qr_decomposition<Type, M, N> result{ a, {} };
+		detail::householder_qr(result.qr.data(), M, N, N, result.tau.data());
+		return result;
+	}
+
+	/* The upper triangular factor of a QR decomposition.
+	*/
+	template<typename Type, std::size_t M, std::size_t N>
+	matrix<Type, N, N> r_factor(qr_decomposition<Type, M, N> const& decomposition) {
+		matrix<Type, N, N> result{};
+		for (std::size_t i = 0; i < N; ++i) {
+			for (std::size_t j = i; j < N; ++j) { result(i, j) = decomposition.qr(i, j); }
+		}
+		return result;
+	}
+
+	/* The first `N` orthonormal columns of the orthogonal factor of a QR decomposition.
+	*/
+	template<typename Type, std::size_t M, std::size_t N>
+	matrix<Type, M, N> q_factor(qr_decomposition<Type, M, N> const& decomposition) {
+		matrix<Type, M, N> result;
+		vector<Type, N> work;
+		detail::householder_q(
+			decomposition.qr.data(), M, N, N, decomposition.tau.data(),
+			result.data(), work.data()
+		);
+		return result;
+	}
+
+	/* Least squares solution of `A * x = b`, which minimizes the euclidean norm of
+	 * `A * x - b`. `A` must have at least as many rows as columns and full column
+	 * rank.
+	 * Note: The solution goes through a QR decomposition of `A`, never through the
+	 * normal equations. Tall and skinny systems are split into blocks of rows that are
+	 * decomposed in parallel.
+	*/
+	template<typename Type, std::size_t M, std::size_t N>
+	vector<Type, N> least_squares(matrix<Type, M, N> const& a, vector<Type, M> const& b) {
+		static_assert(std::is_floating_point<Type>::value, "least squares requires floating point elements");
+		static_assert(M >= N, "least squares requires at least as many rows as columns");
+		std::vector<Type> lhs(a.begin(), a.end()), rhs(b.begin(), b.end());
+		detail::least_squares(lhs.data(), rhs.data(), M, N, 1);
+		vector<Type, N> x;
+		for (std::size_t i = 0; i < N; ++i) { x[i] = rhs[i]; }
+		return x;
+	}
+
+	/* Least squares solution for every column of `B` at once.
+	*/
+	template<typename Type, std::size_t M, std::size_t N, std::size_t K>
+	matrix<Type, N, K> least_squares(matrix<Type, M, N> const& a, matrix<Type, M, K> const& b) {
+		static_assert(std::is_floating_point<Type>::value, "least squares requires floating point elements");
+		static_assert(M >= N, "least squares requires at least as many rows as columns");
+		std::vector<Type> lhs(a.begin(), a.end()), rhs(b.begin(), b.end());
+		detail::least_squares(lhs.data(), rhs.data(), M, N, K);
+		matrix<Type, N, K> x;
+		for (std::size_t i = 0; i < N * K; ++i) { x.data()[i] = rhs[i]; }
+		return x;
+	}
+
+}
\ No newline at end of file
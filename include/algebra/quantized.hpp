@@ -0,0 +1,133 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../tensor.hpp"
+#include "../matrix.hpp"
+#include "../quantized_tensor.hpp"
+#include "../detail/gemm.hpp"
+#include "../detail/parallel.hpp"
+#include "../detail/permute.hpp"
+#include "reduction.hpp"
+
+namespace sor {
+
+	/* Implementation details.
+	*/
+	namespace detail {
+
+		/* Minimum number of multiply adds computed by each thread in a quantized matrix
+		 * multiplication.
+		*/
+		constexpr std::size_t quantized_grain = std::size_t(1) << 20;
+
+		/* Integer sums of the `rows` rows of `columns` contiguous elements of `data`.
+		*/
+		template<typename Type>
+		std::vector<std::int32_t> row_sums(Type const* data, std::size_t rows, std::size_t columns) {
+			std::vector<std::int32_t> sums(rows);
+			for (std::size_t i = 0; i < rows; ++i) {
+				Type const* row = data + i * columns;
+				std::int32_t sum = 0;
+				for (std::size_t j = 0; j < columns; ++j) { sum += row[j]; }
+				sums[i] = sum;
+			}
+			return sums;
+		}
+
+	}
+
+	/* Quantization of a tensor to 8 bit integers. The range of each group, widened to
+	 * include zero, is mapped affinely onto `[-128, 127]`, so that every element is
+	 * represented within about half a scale and zero exactly.
+	 * Example:
+	 * 		sor::vector<float, 4> v({ -1.28f, 0.0f, 0.5f, 1.27f });
+	 * 		auto q = sor::quantize<sor::quantization::per_tensor>(v);
+	 * 		// q.scales[0] == 0.01f, q.values == { -128, 0, 50, 127 }
+	*/
+	template<quantization Granularity, typename Type, std::size_t... Dims>
+	quantized_tensor<Granularity, Dims...> quantize(tensor<Type, Dims...> const& input) {
+		using result_type = quantized_tensor<Granularity, Dims...>;
+		result_type result;
+		for (std::size_t g = 0; g < result_type::groups; ++g) {
+			Type const* in = input.data() + g * result_type::group_size;
+			std::int8_t* out = result.values.data() + g * result_type::group_size;
+			float low = 0, high = 0;
+			if (result_type::group_size > 0) {
+				low = std::min(0.0f, float(detail::fold_contiguous<Type>(in, result_type::group_size, detail::min_operation())));
+				high = std::max(0.0f, float(detail::fold_contiguous<Type>(in, result_type::group_size, detail::max_operation())));
+			}
+			float const scale = high > low ? (high - low) / 255 : 1.0f;
+			float const zero_point = std::min(127.0f, std::max(-128.0f, -128 - low / scale));
+			std::int32_t const offset = static_cast<std::int32_t>(zero_point + (zero_point < 0 ? -0.5f : 0.5f));
+			float const inverse = 1 / scale;
+			for (std::size_t i = 0; i < result_type::group_size; ++i) {
+				float const value = std::min(127.0f, std::max(-128.0f, float(in[i]) * inverse + float(offset)));
+				out[i] = static_cast<std::int8_t>(value + (value < 0 ? -0.5f : 0.5f));
+			}
+			result.scales[g] = scale;
+			result.zero_points[g] = offset;
+		}
+		return result;
+	}
+
+	/* Real numbers represented by a quantized tensor.
+	*/
+	template<quantization Granularity, std::size_t... Dims>
+	tensor<float, Dims...> dequantize(quantized_tensor<Granularity, Dims...> const& input) {
+		using input_type = quantized_tensor<Granularity, Dims...>;
+		tensor<float, Dims...> result;
+		for (std::size_t g = 0; g < input_type::groups; ++g) {
+			std::int8_t const* in = input.values.data() + g * input_type::group_size;
+			float* out = result.data() + g * input_type::group_size;
+			float const scale = input.scales[g];
+			float const zero_point = float(input.zero_points[g]);
+			for (std::size_t i = 0; i < input_type::group_size; ++i) {
+				out[i] = scale * (float(in[i]) - zero_point);
+			}
+		}
+		return result;
+	}
+
+	/* Product of quantized matrices, whose rows of `lhs` may have their own scales.
+	 * The integer products are accumulated in 32 bits by `detail::gemm_int8`, and the
+	 * zero points are accounted for afterwards from the row sums of `lhs` and column
+	 * sums of `rhs`, through
+	 * `sum((a - za) * (b - zb)) = sum(a * b) - zb * sum(a) - za * sum(b) + K * za * zb`,
+	 * so that the inner loops only see the 8 bit values. Rows are split between
+	 * threads for large products.
+	*/
+	template<quantization Granularity, std::size_t M, std::size_t K, std::size_t N>
+	matrix<float, M, N> quantized_multiply(
+		quantized_matrix<Granularity, M, K> const& lhs,
+		quantized_matrix<quantization::per_tensor, K, N> const& rhs
+	) {
+		using lhs_type = quantized_matrix<Granularity, M, K>;
+		matrix<float, M, N> result;
+		std::vector<std::int8_t> transposed(N * K);
+		detail::transpose(rhs.values.data(), K, N, transposed.data());
+		std::vector<std::int32_t> const row_sums = detail::row_sums(lhs.values.data(), M, K);
+		std::vector<std::int32_t> const column_sums = detail::row_sums(transposed.data(), N, K);
+		std::vector<std::int32_t> sums(M * N);
+		std::int64_t const rhs_zero = rhs.zero_points[0];
+		std::size_t const grain = std::max<std::size_t>(1, detail::quantized_grain / (N * K + 1));
+		detail::parallel_for(M, grain, [&](std::size_t begin, std::size_t end) {
+			detail::gemm_int8_transposed(end - begin, N, K, lhs.values.data() + begin * K, transposed.data(), sums.data() + begin * N);
+			for (std::size_t i = begin; i < end; ++i) {
+				std::size_t const group = lhs_type::groups == 1 ? 0 : i;
+				std::int64_t const lhs_zero = lhs.zero_points[group];
+				float const scale = lhs.scales[group] * rhs.scales[0];
+				std::int64_t const offset = std::int64_t(K) * lhs_zero * rhs_zero - rhs_zero * row_sums[i];
+				for (std::size_t j = 0; j < N; ++j) {
+					std::int64_t const exact = sums[i * N + j] + offset - lhs_zero * column_sums[j];
+					result(i, j) = scale * float(exact);
+				}
+			}
+		});
+		return result;
+	}
+
+}
\ No newline at end of file
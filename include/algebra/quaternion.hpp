@@ -0,0 +1,246 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include "../vector.hpp"
+#include "../matrix.hpp"
+#include "../quaternion.hpp"
+#include "../detail/parallel.hpp"
+#include "vector.hpp"
+
+namespace sor {
+
+	/* Implementation details.
+	*/
+	namespace detail {
+
+		/* Minimum number of points transformed by each thread.
+		*/
+		constexpr std::size_t transform_grain = std::size_t(1) << 14;
+
+		/* Number of points whose coordinates are computed into a local block before
+		 * being stored, which tells the compiler that the stores can't overlap the
+		 * points still to be read.
+		*/
+		constexpr std::size_t transform_block = 256;
+
+		/* `out[j] = r0 * x[j] + r1 * y[j] + r2 * z[j] + t` over `count` points. Full
+		 * blocks take a loop with a constant trip count, which vectorizes without a
+		 * scalar epilogue.
+		*/
+		template<typename Type>
+		void affine_block(std::size_t count, Type r0, Type r1, Type r2, Type t, Type const* x, Type const* y, Type const* z, Type* out) {
+			auto coordinate = [=](std::size_t j) { return r0 * x[j] + r1 * y[j] + r2 * z[j] + t; };
+			if (count == transform_block) {
+				for (std::size_t j = 0; j < transform_block; ++j) { out[j] = coordinate(j); }
+			} else {
+				for (std::size_t j = 0; j < count; ++j) { out[j] = coordinate(j); }
+			}
+		}
+
+		/* Lanes and signs of `rhs` that each imaginary component of `lhs` multiplies in
+		 * the Hamilton product, in `x, y, z, w` order.
+		*/
+		constexpr std::size_t hamilton_lanes[3][4] = { { 3, 2, 1, 0 }, { 2, 3, 0, 1 }, { 1, 0, 3, 2 } };
+		constexpr int hamilton_signs[3][4] = { { 1, -1, 1, -1 }, { 1, 1, -1, -1 }, { -1, 1, 1, -1 } };
+
+	}
+
+	/* Hamilton product, which composes rotations: `lhs * rhs` rotates by `rhs` first.
+	 * It is computed as `lhs.w * rhs` plus each imaginary component of `lhs` times a
+	 * permutation of the lanes of `rhs` with fixed signs, four broadcast multiply adds
+	 * over four lanes, against the 64 products of composing 4 x 4 matrices.
+	*/
+	template<typename LhsType, typename RhsType>
+	constexpr auto operator*(quaternion<LhsType> const& lhs, quaternion<RhsType> const& rhs) {
+		using common_type = typename std::common_type<LhsType, RhsType>::type;
+		vector<common_type, 4> result{};
+		auto const& a = lhs.components();
+		auto const& b = rhs.components();
+		for (std::size_t i = 0; i < 4; ++i) { result[i] = common_type(a[3]) * b[i]; }
+		for (std::size_t c = 0; c < 3; ++c) {
+			for (std::size_t i = 0; i < 4; ++i) {
+				result[i] += common_type(a[c]) * detail::hamilton_signs[c][i] * b[detail::hamilton_lanes[c][i]];
+			}
+		}
+		return quaternion<common_type>(result);
+	}
+
+	/* Conjugate, the inverse of a unit quaternion.
+	*/
+	template<typename Type>
+	constexpr quaternion<Type> conjugate(quaternion<Type> const& q) {
+		return quaternion<Type>(-q.x(), -q.y(), -q.z(), q.w());
+	}
+
+	/* Norm, which is one for rotations.
+	*/
+	template<typename Type>
+	Type norm(quaternion<Type> const& q) {
+		return std::sqrt(dot_product(q.components(), q.components()));
+	}
+
+	/* Quaternion normalization.
+	*/
+	template<typename Type>
+	void normalize(quaternion<Type>& q) {
+		normalize(q.components());
+	}
+
+	/* Multiplicative inverse.
+	*/
+	template<typename Type>
+	quaternion<Type> inverse(quaternion<Type> const& q) {
+		Type const squared = dot_product(q.components(), q.components());
+		assert(squared != Type());
+		return quaternion<Type>(-q.x() / squared, -q.y() / squared, -q.z() / squared, q.w() / squared);
+	}
+
+	/* Rotation by `angle` radians around the unit vector `axis`, counterclockwise when
+	 * looking against it.
+	*/
+	template<typename Type>
+	quaternion<Type> from_axis_angle(vector<Type, 3> const& axis, Type angle) {
+		Type const s = std::sin(angle / 2);
+		return quaternion<Type>(axis[0] * s, axis[1] * s, axis[2] * s, std::cos(angle / 2));
+	}
+
+	/* Rotation of `v` by the unit quaternion `q`, as
+	 * `v + 2 * w * (u x v) + 2 * u x (u x v)` with `u` the imaginary part of `q`: two
+	 * cross products rather than two Hamilton products.
+	*/
+	template<typename Type>
+	constexpr vector<Type, 3> rotate(quaternion<Type> const& q, vector<Type, 3> const& v) {
+		vector<Type, 3> const u = q.imaginary();
+		vector<Type, 3> t = cross_product(u, v);
+		for (std::size_t i = 0; i < 3; ++i) { t[i] *= Type(2); }
+		vector<Type, 3> const twice = cross_product(u, t);
+		vector<Type, 3> result{};
+		for (std::size_t i = 0; i < 3; ++i) { result[i] = v[i] + q.w() * t[i] + twice[i]; }
+		return result;
+	}
+
+	/* Rotation matrix of the unit quaternion `q`.
+	*/
+	template<typename Type>
+	constexpr matrix<Type, 3, 3> to_rotation_matrix(quaternion<Type> const& q) {
+		Type const x = q.x(), y = q.y(), z = q.z(), w = q.w();
+		return matrix<Type, 3, 3>({
+			1 - 2 * (y * y + z * z), 2 * (x * y - z * w), 2 * (x * z + y * w),
+			2 * (x * y + z * w), 1 - 2 * (x * x + z * z), 2 * (y * z - x * w),
+			2 * (x * z - y * w), 2 * (y * z + x * w), 1 - 2 * (x * x + y * y)
+		});
+	}
+
+	/* Unit quaternion of the rotation matrix `m`, by Shepperd's method: the largest of
+	 * the four squared components is found from the diagonal and taken as the pivot,
+	 * so that the division is well conditioned for every rotation.
+	*/
+	template<typename Type>
+	quaternion<Type> from_rotation_matrix(matrix<Type, 3, 3> const& m) {
+		Type const trace = m(0, 0) + m(1, 1) + m(2, 2);
+		if (trace > m(0, 0) && trace > m(1, 1) && trace > m(2, 2)) {
+			Type const s = std::sqrt(trace + 1) * 2;
+			return quaternion<Type>((m(2, 1) - m(1, 2)) / s, (m(0, 2) - m(2, 0)) / s, (m(1, 0) - m(0, 1)) / s, s / 4);
+		}
+		if (m(0, 0) >= m(1, 1) && m(0, 0) >= m(2, 2)) {
+			Type const s = std::sqrt(1 + m(0, 0) - m(1, 1) - m(2, 2)) * 2;
+			return quaternion<Type>(s / 4, (m(0, 1) + m(1, 0)) / s, (m(0, 2) + m(2, 0)) / s, (m(2, 1) - m(1, 2)) / s);
+		}
+		if (m(1, 1) >= m(2, 2)) {
+			Type const s = std::sqrt(1 + m(1, 1) - m(0, 0) - m(2, 2)) * 2;
+			return quaternion<Type>((m(0, 1) + m(1, 0)) / s, s / 4, (m(1, 2) + m(2, 1)) / s, (m(0, 2) - m(2, 0)) / s);
+		}
+		Type const s = std::sqrt(1 + m(2, 2) - m(0, 0) - m(1, 1)) * 2;
+		return quaternion<Type>((m(0, 2) + m(2, 0)) / s, (m(1, 2) + m(2, 1)) / s, s / 4, (m(1, 0) - m(0, 1)) / s);
+	}
+
+	/* Spherical linear interpolation between the unit quaternions `from` and `to`,
+	 * along the shorter arc: `t = 0` gives `from` and `t = 1` the rotation of `to`.
+	 * Nearly parallel quaternions are interpolated linearly and normalized, where the
+	 * sine of the angle between them would lose precision.
+	*/
+	template<typename Type>
+	quaternion<Type> slerp(quaternion<Type> const& from, quaternion<Type> const& to, Type t) {
+		vector<Type, 4> target = to.components();
+		Type cosine = dot_product(from.components(), target);
+		if (cosine < Type()) {
+			cosine = -cosine;
+			for (auto& element : target) { element = -element; }
+		}
+		Type from_weight = 1 - t;
+		Type to_weight = t;
+		if (cosine < Type(0.9995)) {
+			Type const angle = std::acos(cosine);
+			Type const sine = std::sin(angle);
+			from_weight = std::sin((1 - t) * angle) / sine;
+			to_weight = std::sin(t * angle) / sine;
+		}
+		vector<Type, 4> result{};
+		for (std::size_t i = 0; i < 4; ++i) { result[i] = from_weight * from.components()[i] + to_weight * target[i]; }
+		quaternion<Type> q(result);
+		normalize(q);
+		return q;
+	}
+
+	/* Composition of rigid transforms: `lhs * rhs` applies `rhs` first.
+	*/
+	template<typename Type>
+	constexpr rigid_transform<Type> operator*(rigid_transform<Type> const& lhs, rigid_transform<Type> const& rhs) {
+		rigid_transform<Type> result{ lhs.rotation * rhs.rotation, rotate(lhs.rotation, rhs.translation) };
+		for (std::size_t i = 0; i < 3; ++i) { result.translation[i] += lhs.translation[i]; }
+		return result;
+	}
+
+	/* Inverse of a rigid transform.
+	*/
+	template<typename Type>
+	constexpr rigid_transform<Type> inverse(rigid_transform<Type> const& pose) {
+		rigid_transform<Type> result{ conjugate(pose.rotation), rotate(conjugate(pose.rotation), pose.translation) };
+		for (std::size_t i = 0; i < 3; ++i) { result.translation[i] = -result.translation[i]; }
+		return result;
+	}
+
+	/* Transforms a single point.
+	*/
+	template<typename Type>
+	constexpr vector<Type, 3> transform_point(rigid_transform<Type> const& pose, vector<Type, 3> const& point) {
+		vector<Type, 3> result = rotate(pose.rotation, point);
+		for (std::size_t i = 0; i < 3; ++i) { result[i] += pose.translation[i]; }
+		return result;
+	}
+
+	/* Transforms a cloud of `N` points stored as structure of arrays, one row per
+	 * coordinate. The rotation is converted to a matrix once, so that each point takes
+	 * nine multiply adds, and each coordinate of the result is computed over a block
+	 * of points from contiguous rows, which vectorizes. Points are split between
+	 * threads for large clouds.
+	*/
+	template<typename Type, std::size_t N>
+	matrix<Type, 3, N> transform_points(rigid_transform<Type> const& pose, matrix<Type, 3, N> const& points) {
+		matrix<Type, 3, N> result;
+		matrix<Type, 3, 3> const r = to_rotation_matrix(pose.rotation);
+		Type const* const in = points.data();
+		Type* const out = result.data();
+		detail::parallel_for(N, detail::transform_grain, [&](std::size_t begin, std::size_t end) {
+			std::array<Type, detail::transform_block> block;
+			for (std::size_t first = begin; first < end; first += detail::transform_block) {
+				std::size_t const count = std::min(detail::transform_block, end - first);
+				Type const* const x = in + first;
+				Type const* const y = x + N;
+				Type const* const z = y + N;
+				for (std::size_t row = 0; row < 3; ++row) {
+					detail::affine_block(count, r(row, 0), r(row, 1), r(row, 2), pose.translation[row], x, y, z, block.data());
+					std::copy(block.begin(), block.begin() + count, out + row * N + first);
+				}
+			}
+		});
+		return result;
+	}
+
+}
\ No newline at end of file
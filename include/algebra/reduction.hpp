@@ -0,0 +1,344 @@
+#pragma once
+
+#include <cstddef>
+#include <array>
+#include <utility>
+#include <type_traits>
+#include <vector>
+
+#include "../tensor.hpp"
+#include "../vector.hpp"
+#include "../matrix.hpp"
+#include "../detail/tmp.hpp"
+#include "summation.hpp"
+
+namespace sor {
+
+	/* Implementation details.
+	*/
+	namespace detail {
+
+		/* Metaprogramming function that returns the type of a tensor with the given
+		 * axis removed. Reducing the only axis of a vector results in a scalar.
+		*/
+		template<typename Type, std::size_t Axis, typename Indexes, std::size_t... Dims>
+		struct remove_axis_impl;
+
+		template<typename Type, std::size_t Axis, std::size_t... Indexes, std::size_t... Dims>
+		struct remove_axis_impl<Type, Axis, std::index_sequence<Indexes...>, Dims...> {
+			using type = tensor<Type, nth<(Indexes < Axis ? Indexes : Indexes + 1), Dims...>()...>;
+		};
+
+		template<typename Type, std::size_t Axis, std::size_t Dim>
+		struct remove_axis_impl<Type, Axis, std::index_sequence<>, Dim> {
+			using type = Type;
+		};
+
+		template<typename Type, std::size_t Axis, std::size_t... Dims>
+		using remove_axis = typename remove_axis_impl<
+			Type, Axis, std::make_index_sequence<sizeof...(Dims) - 1>, Dims...
+		>::type;
+
+		/* A tensor seen as `outer` consecutive blocks of `length` slices, each slice
+		 * holding `inner` contiguous elements, where `length` is the extent of the
+		 * reduced axis.
+		*/
+		template<std::size_t Axis, std::size_t... Dims>
+		struct axis_layout {
+			static_assert(Axis < sizeof...(Dims), "axis out of range");
+			static constexpr std::size_t outer = product<0, Axis, Dims...>();
+			static constexpr std::size_t length = nth<Axis, Dims...>();
+			static constexpr std::size_t inner = product<Axis + 1, sizeof...(Dims), Dims...>();
+		};
+
+		/* Access to the storage of a reduction result, whether a tensor or a scalar.
+		*/
+		template<typename Type, std::size_t... Dims>
+		Type* output_data(tensor<Type, Dims...>& result) noexcept { return result.data(); }
+
+		template<typename Type>
+		Type* output_data(Type& result) noexcept { return &result; }
+
+		/* Number of independent accumulators used by the horizontal kernels. Splitting
+		 * the dependency chain lets the compiler keep each accumulator in a SIMD lane.
+		*/
+		constexpr std::size_t reduction_lanes = 8;
+
+		/* Folds `size` contiguous elements with `op`. At least one element is required.
+		*/
+		template<typename Result, typename Type, typename Operation>
+		Result fold_contiguous(Type const* data, std::size_t size, Operation op) {
+			if (size < reduction_lanes) {
+				Result result = data[0];
+				for (std::size_t i = 1; i < size; ++i) { result = op(result, data[i]); }
+				return result;
+			}
+			Result partial[reduction_lanes];
+			for (std::size_t j = 0; j < reduction_lanes; ++j) { partial[j] = data[j]; }
+			std::size_t i = reduction_lanes;
+			for (; i + reduction_lanes <= size; i += reduction_lanes) {
+				for (std::size_t j = 0; j < reduction_lanes; ++j) {
+					partial[j] = op(partial[j], data[i + j]);
+				}
+			}
+			Result result = partial[0];
+			for (std::size_t j = 1; j < reduction_lanes; ++j) { result = op(result, partial[j]); }
+			for (Type const* tail = data + i; tail != data + size; ++tail) { result = op(result, *tail); }
+			return result;
+		}
+
+		/* Folds `length` slices of `inner` contiguous elements, `inner` apart, into
+		 * `out`, element by element. Every pass over a slice is a contiguous loop.
+		*/
+		template<typename Result, typename Type, typename Operation>
+		void fold_strided(Type const* data, Result* out, std::size_t length, std::size_t inner, Operation op) {
+			for (std::size_t j = 0; j < inner; ++j) { out[j] = data[j]; }
+			for (std::size_t k = 1; k < length; ++k) {
+				Type const* slice = data + k * inner;
+				for (std::size_t j = 0; j < inner; ++j) {
+					out[j] = op(out[j], slice[j]);
+				}
+			}
+		}
+
+		/* Reduces the axis described by `Layout` with `op`, writing one element of
+		 * `out` per reduced slice.
+		*/
+		template<typename Layout, typename Result, typename Type, typename Operation>
+		void fold_axis(Type const* data, Result* out, Operation op) {
+			for (std::size_t o = 0; o < Layout::outer; ++o) {
+				Type const* block = data + o * Layout::length * Layout::inner;
+				if constexpr (Layout::inner == 1) {
+					out[o] = fold_contiguous<Result>(block, Layout::length, op);
+				} else {
+					fold_strided(block, out + o * Layout::inner, Layout::length, Layout::inner, op);
+				}
+			}
+		}
+
+		/* Finds the position of the first element along the axis described by `Layout`
+		 * for which `better(element, best)` holds against every other element.
+		*/
+		template<typename Layout, typename Type, typename Compare>
+		void select_axis(Type const* data, std::size_t* out, Compare better) {
+			for (std::size_t o = 0; o < Layout::outer; ++o) {
+				Type const* block = data + o * Layout::length * Layout::inner;
+				if constexpr (Layout::inner == 1) {
+					Type best[reduction_lanes];
+					std::size_t index[reduction_lanes];
+					for (std::size_t j = 0; j < reduction_lanes; ++j) {
+						best[j] = block[0];
+						index[j] = 0;
+					}
+					std::size_t i = 0;
+					for (; i + reduction_lanes <= Layout::length; i += reduction_lanes) {
+						for (std::size_t j = 0; j < reduction_lanes; ++j) {
+							bool is_better = better(block[i + j], best[j]);
+							best[j] = is_better ? block[i + j] : best[j];
+							index[j] = is_better ? i + j : index[j];
+						}
+					}
+					for (std::size_t j = 1; j < reduction_lanes; ++j) {
+						if (better(best[j], best[0]) || (!better(best[0], best[j]) && index[j] < index[0])) {
+							best[0] = best[j];
+							index[0] = index[j];
+						}
+					}
+					for (; i < Layout::length; ++i) {
+						if (better(block[i], best[0])) {
+							best[0] = block[i];
+							index[0] = i;
+						}
+					}
+					out[o] = index[0];
+				} else {
+					std::array<Type, Layout::inner> best;
+					std::size_t* index = out + o * Layout::inner;
+					for (std::size_t j = 0; j < Layout::inner; ++j) {
+						best[j] = block[j];
+						index[j] = 0;
+					}
+					for (std::size_t k = 1; k < Layout::length; ++k) {
+						Type const* slice = block + k * Layout::inner;
+						for (std::size_t j = 0; j < Layout::inner; ++j) {
+							bool is_better = better(slice[j], best[j]);
+							best[j] = is_better ? slice[j] : best[j];
+							index[j] = is_better ? k : index[j];
+						}
+					}
+				}
+			}
+		}
+
+		struct plus_operation {
+			template<typename Lhs, typename Rhs>
+			auto operator()(Lhs const& lhs, Rhs const& rhs) const { return lhs + rhs; }
+		};
+
+		struct min_operation {
+			template<typename Lhs, typename Rhs>
+			Lhs operator()(Lhs const& lhs, Rhs const& rhs) const { return rhs < lhs ? Lhs(rhs) : lhs; }
+		};
+
+		struct max_operation {
+			template<typename Lhs, typename Rhs>
+			Lhs operator()(Lhs const& lhs, Rhs const& rhs) const { return lhs < rhs ? Lhs(rhs) : lhs; }
+		};
+
+		struct less_compare {
+			template<typename Type>
+			bool operator()(Type const& lhs, Type const& rhs) const { return lhs < rhs; }
+		};
+
+		struct greater_compare {
+			template<typename Type>
+			bool operator()(Type const& lhs, Type const& rhs) const { return rhs < lhs; }
+		};
+
+		/* Pairwise sums of `length` slices of `inner` contiguous elements, `inner`
+		 * apart, into `out`: the slices are halved, on a block boundary, until they fit
+		 * in a block, which is folded with contiguous loops.
+		*/
+		template<typename Result, typename Type>
+		void pairwise_slices(Type const* data, Result* out, std::size_t length, std::size_t inner) {
+			if (length <= pairwise_block) {
+				fold_strided(data, out, length, inner, plus_operation());
+				return;
+			}
+			std::size_t const blocks = (length + pairwise_block - 1) / pairwise_block;
+			std::size_t const half = blocks / 2 * pairwise_block;
+			pairwise_slices(data, out, half, inner);
+			std::vector<Result> rest(inner);
+			pairwise_slices(data + half * inner, rest.data(), length - half, inner);
+			for (std::size_t j = 0; j < inner; ++j) { out[j] += rest[j]; }
+		}
+
+		/* Kahan-Babuška sums of `length` slices of `inner` contiguous elements, `inner`
+		 * apart, into `out`, with one compensation per element of the slices.
+		*/
+		template<typename Result, typename Type>
+		void compensated_slices(Type const* data, Result* out, std::size_t length, std::size_t inner) {
+			std::vector<Result> compensations(inner, Result());
+			for (std::size_t j = 0; j < inner; ++j) { out[j] = data[j]; }
+			for (std::size_t k = 1; k < length; ++k) {
+				Type const* slice = data + k * inner;
+				for (std::size_t j = 0; j < inner; ++j) {
+					compensated_add(out[j], compensations[j], Result(slice[j]));
+				}
+			}
+			for (std::size_t j = 0; j < inner; ++j) { out[j] = compensated_total(out[j], compensations[j]); }
+		}
+
+		/* Sums the axis described by `Layout` with the given policy, writing one element
+		 * of `out` per reduced slice.
+		*/
+		template<typename Layout, typename Result, typename Type>
+		void sum_axis(Type const* data, Result* out, summation mode) {
+			if (mode == summation::naive) {
+				fold_axis<Layout>(data, out, plus_operation());
+				return;
+			}
+			for (std::size_t o = 0; o < Layout::outer; ++o) {
+				Type const* block = data + o * Layout::length * Layout::inner;
+				if constexpr (Layout::inner == 1) {
+					out[o] = accumulate<Result>(Layout::length, mode, [block](std::size_t i) { return block[i]; });
+				} else if (mode == summation::pairwise) {
+					pairwise_slices(block, out + o * Layout::inner, Layout::length, Layout::inner);
+				} else {
+					compensated_slices(block, out + o * Layout::inner, Layout::length, Layout::inner);
+				}
+			}
+		}
+
+	}
+
+	/* Sum along an axis.
+	 * The result is a tensor of one less order (or a scalar, for vectors) holding the
+	 * sum of the elements of each slice along the given axis.
+	 * Example:
+	 * 		sor::matrix<int, 2, 3> matrix({
+	 * 			1, 2, 3,
+	 * 			4, 5, 6
+	 * 		});
+	 * 		sor::sum<0>(matrix); // = { 5, 7, 9 }
+	 * 		sor::sum<1>(matrix); // = { 6, 15 }
+	 * Note: The sums are of the `sor::accumulation_type` of the elements, computed
+	 * with the given `sor::summation` policy.
+	*/
+	template<std::size_t Axis, typename Type, std::size_t... Dims>
+	auto sum(tensor<Type, Dims...> const& input, summation mode = summation::naive) {
+		using layout = detail::axis_layout<Axis, Dims...>;
+		using value_type = typename accumulation_type<Type>::type;
+		detail::remove_axis<value_type, Axis, Dims...> result{};
+		if constexpr (layout::length > 0) {
+			detail::sum_axis<layout>(input.data(), detail::output_data(result), mode);
+		}
+		return result;
+	}
+
+	/* Arithmetic mean along an axis.
+	 * The mean of integral tensors is computed as `double`, and that of narrow
+	 * floating point tensors in their `sor::accumulation_type`. The sums take the
+	 * given `sor::summation` policy.
+	*/
+	template<std::size_t Axis, typename Type, std::size_t... Dims>
+	auto mean(tensor<Type, Dims...> const& input, summation mode = summation::naive) {
+		using layout = detail::axis_layout<Axis, Dims...>;
+		using accumulator = typename accumulation_type<Type>::type;
+		using value_type = typename std::conditional<
+			std::is_floating_point<accumulator>::value, accumulator, double
+		>::type;
+		static_assert(layout::length > 0, "the mean of an empty axis is undefined");
+		detail::remove_axis<value_type, Axis, Dims...> result{};
+		auto out = detail::output_data(result);
+		detail::sum_axis<layout>(input.data(), out, mode);
+		for (std::size_t i = 0; i < layout::outer * layout::inner; ++i) {
+			out[i] /= static_cast<value_type>(layout::length);
+		}
+		return result;
+	}
+
+	/* Minimum and maximum along an axis.
+	 * Elements are compared with `operator<`.
+	*/
+	template<std::size_t Axis, typename Type, std::size_t... Dims>
+	auto min(tensor<Type, Dims...> const& input) {
+		using layout = detail::axis_layout<Axis, Dims...>;
+		static_assert(layout::length > 0, "the minimum of an empty axis is undefined");
+		detail::remove_axis<Type, Axis, Dims...> result{};
+		detail::fold_axis<layout>(input.data(), detail::output_data(result), detail::min_operation());
+		return result;
+	}
+
+	template<std::size_t Axis, typename Type, std::size_t... Dims>
+	auto max(tensor<Type, Dims...> const& input) {
+		using layout = detail::axis_layout<Axis, Dims...>;
+		static_assert(layout::length > 0, "the maximum of an empty axis is undefined");
+		detail::remove_axis<Type, Axis, Dims...> result{};
+		detail::fold_axis<layout>(input.data(), detail::output_data(result), detail::max_operation());
+		return result;
+	}
+
+	/* Position of the minimum and maximum along an axis.
+	 * When more elements share the extreme value, the position of the first one is
+	 * returned.
+	*/
+	template<std::size_t Axis, typename Type, std::size_t... Dims>
+	auto argmin(tensor<Type, Dims...> const& input) {
+		using layout = detail::axis_layout<Axis, Dims...>;
+		static_assert(layout::length > 0, "the minimum of an empty axis is undefined");
+		detail::remove_axis<std::size_t, Axis, Dims...> result{};
+		detail::select_axis<layout>(input.data(), detail::output_data(result), detail::less_compare());
+		return result;
+	}
+
+	template<std::size_t Axis, typename Type, std::size_t... Dims>
+	auto argmax(tensor<Type, Dims...> const& input) {
+		using layout = detail::axis_layout<Axis, Dims...>;
+		static_assert(layout::length > 0, "the maximum of an empty axis is undefined");
+		detail::remove_axis<std::size_t, Axis, Dims...> result{};
+		detail::select_axis<layout>(input.data(), detail::output_data(result), detail::greater_compare());
+		return result;
+	}
+
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "../vector.hpp"
+#include "../matrix.hpp"
+#include "../sparse_matrix.hpp"
+#include "../detail/axpy.hpp"
+#include "../detail/parallel.hpp"
+
+namespace sor {
+
+	/* Implementation details.
+	*/
+	namespace detail {
+
+		/* Calls `function(part, begin, end)` on consecutive ranges of the major positions
+		 * (rows of a CSR matrix, columns of a CSC one) of a compressed matrix, in
+		 * parallel. Ranges balance their number of nonzero elements rather than of
+		 * positions, so that a few dense rows don't leave the other threads idle.
+		*/
+		template<typename Function>
+		void parallel_outer(std::vector<std::size_t> const& offsets, std::size_t parts, Function&& function) {
+			std::size_t const outer = offsets.size() - 1;
+			auto boundary = [&offsets, outer, parts](std::size_t part) {
+				if (part == parts) { return outer; }
+				std::size_t const target = offsets.back() * part / parts;
+				return std::size_t(std::lower_bound(offsets.begin(), offsets.end() - 1, target) - offsets.begin());
+			};
+			parallel_for(parts, 1, [&](std::size_t first, std::size_t last) {
+				for (std::size_t part = first; part < last; ++part) {
+					function(part, boundary(part), boundary(part + 1));
+				}
+			});
+		}
+
+		/* Number of parts into which `non_zeros` sparse elements are split between threads.
+		*/
+		inline std::size_t sparse_parts(std::size_t non_zeros) noexcept {
+			std::size_t const parts = std::min(thread_count(), non_zeros / sparse_grain);
+			return parts == 0 ? 1 : parts;
+		}
+
+		/* `C = A * B` for the CSR matrix `A` and the row major `B` and `C`, with `k`
+		 * columns; each row of `C` is written by one thread only.
+		*/
+		template<typename AType, typename BType, typename CType>
+		void csr_multiply(
+			std::vector<std::size_t> const& offsets, std::vector<std::size_t> const& columns, std::vector<AType> const& values,
+			std::size_t k, BType const* b, CType* c
+		) {
+			parallel_outer(offsets, sparse_parts(offsets.back()), [&](std::size_t, std::size_t begin, std::size_t end) {
+				for (std::size_t i = begin; i < end; ++i) {
+					if (k == 1) {
+						CType sum = CType();
+						for (std::size_t e = offsets[i]; e < offsets[i + 1]; ++e) { sum += values[e] * b[columns[e]]; }
+						c[i] = sum;
+					} else {
+						CType* const out = c + i * k;
+						std::fill(out, out + k, CType());
+						for (std::size_t e = offsets[i]; e < offsets[i + 1]; ++e) { axpy(k, values[e], b + columns[e] * k, out); }
+					}
+				}
+			});
+		}
+
+		/* `C = A * B` for the `m` row CSC matrix `A` and the row major `B` and `C`, with
+		 * `k` columns. Each column of `A` scatters into arbitrary rows of `C`, so every
+		 * thread but the first accumulates into a private copy of `C`, and the copies are
+		 * summed at the end.
+		*/
+		template<typename AType, typename BType, typename CType>
+		void csc_multiply(
+			std::size_t m, std::vector<std::size_t> const& offsets, std::vector<std::size_t> const& rows, std::vector<AType> const& values,
+			std::size_t k, BType const* b, CType* c
+		) {
+			std::size_t const parts = sparse_parts(offsets.back());
+			std::vector<CType> partials((parts - 1) * m * k, CType());
+			std::fill(c, c + m * k, CType());
+			parallel_outer(offsets, parts, [&](std::size_t part, std::size_t begin, std::size_t end) {
+				CType* const out = part == 0 ? c : partials.data() + (part - 1) * m * k;
+				for (std::size_t j = begin; j < end; ++j) {
+					for (std::size_t e = offsets[j]; e < offsets[j + 1]; ++e) { axpy(k, values[e], b + j * k, out + rows[e] * k); }
+				}
+			});
+			for (std::size_t part = 1; part < parts; ++part) {
+				axpy(m * k, 1, partials.data() + (part - 1) * m * k, c);
+			}
+		}
+
+	}
+
+	/* Sparse matrix vector multiplication (SpMV). Rows are split between threads for
+	 * large matrices.
+	*/
+	template<typename LhsType, typename RhsType, std::size_t M, std::size_t N>
+	auto operator*(csr_matrix<LhsType, M, N> const& lhs, vector<RhsType, N> const& rhs) {
+		using common_type = typename std::common_type<LhsType, RhsType>::type;
+		vector<common_type, M> result;
+		detail::csr_multiply(lhs.row_offsets(), lhs.column_indexes(), lhs.values(), 1, rhs.data(), result.data());
+		return result;
+	}
+
+	template<typename LhsType, typename RhsType, std::size_t M, std::size_t N>
+	auto operator*(csc_matrix<LhsType, M, N> const& lhs, vector<RhsType, N> const& rhs) {
+		using common_type = typename std::common_type<LhsType, RhsType>::type;
+		vector<common_type, M> result;
+		detail::csc_multiply(M, lhs.column_offsets(), lhs.row_indexes(), lhs.values(), 1, rhs.data(), result.data());
+		return result;
+	}
+
+	/* Multiplication of a sparse matrix by a dense one (SpMM), which streams each row of
+	 * the dense matrix once per nonzero element that refers to it.
+	*/
+	template<typename LhsType, typename RhsType, std::size_t M, std::size_t N, std::size_t K>
+	auto operator*(csr_matrix<LhsType, M, N> const& lhs, matrix<RhsType, N, K> const& rhs) {
+		using common_type = typename std::common_type<LhsType, RhsType>::type;
+		matrix<common_type, M, K> result;
+		detail::csr_multiply(lhs.row_offsets(), lhs.column_indexes(), lhs.values(), K, rhs.data(), result.data());
+		return result;
+	}
+
+	template<typename LhsType, typename RhsType, std::size_t M, std::size_t N, std::size_t K>
+	auto operator*(csc_matrix<LhsType, M, N> const& lhs, matrix<RhsType, N, K> const& rhs) {
+		using common_type = typename std::common_type<LhsType, RhsType>::type;
+		matrix<common_type, M, K> result;
+		detail::csc_multiply(M, lhs.column_offsets(), lhs.row_indexes(), lhs.values(), K, rhs.data(), result.data());
+		return result;
+	}
+
+}
\ No newline at end of file
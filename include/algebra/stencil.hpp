@@ -0,0 +1,324 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "../tensor.hpp"
+#include "../detail/parallel.hpp"
+
+namespace sor {
+
+	/* How stencils and convolutions read the elements beyond the edges of a tensor: as
+	 * zero, as the nearest element on the edge, or wrapping around to the other side.
+	*/
+	enum class boundary { zero, clamp, periodic };
+
+	/* Implementation details.
+	*/
+	namespace detail {
+
+		/* Minimum number of elements that a thread computes at once, and size that the
+		 * planes of a temporally blocked strip should fit in.
+		*/
+		constexpr std::size_t stencil_grain = std::size_t(1) << 15;
+		constexpr std::size_t stencil_cache_bytes = std::size_t(1) << 20;
+
+		/* Number of time steps advanced at once by each strip of planes.
+		*/
+		constexpr std::size_t stencil_time_block = 4;
+
+		/* Index of the element read at position `i` of an axis of `n` elements, or `n` if
+		 * it is zero.
+		*/
+		inline std::size_t boundary_index(std::ptrdiff_t i, std::size_t n, boundary mode) noexcept {
+			std::ptrdiff_t const extent = std::ptrdiff_t(n);
+			if (i >= 0 && i < extent) { return std::size_t(i); }
+			switch (mode) {
+				case boundary::clamp: return i < 0 ? 0 : n - 1;
+				case boundary::periodic: return std::size_t((i % extent + extent) % extent);
+				default: return n;
+			}
+		}
+
+		/* Shape of a stencil over tensors seen as `outer` planes of `rows` x `columns`
+		 * elements, with a `ko` x `kh` x `kw` kernel of odd extents centered on each
+		 * element. Two dimensional tensors are seen as planes of a single row.
+		*/
+		struct stencil_shape {
+			std::size_t outer, rows, columns;
+			std::size_t ko, kh, kw;
+			boundary mode;
+
+			std::size_t plane() const noexcept { return rows * columns; }
+		};
+
+		/* Number of elements of a row that the taps of a stencil are accumulated into at
+		 * once, in a local buffer, and number of taps accumulated in each pass over it.
+		*/
+		constexpr std::size_t stencil_block = 256;
+		constexpr std::size_t stencil_taps = 4;
+
+		/* Tap of a stencil on a row: element `j` of the output row reads element
+		 * `j + shift` of the input `row`, with weight `weight`.
+		*/
+		template<typename Type>
+		struct stencil_tap {
+			Type const* row;
+			std::ptrdiff_t shift;
+			Type weight;
+		};
+
+		/* `out[j] = sum(tap.weight * tap.row[j + tap.shift])` over `taps`, whose number
+		 * must be a multiple of `stencil_taps`, for `j` in `[first, last)`, which must
+		 * stay within the input rows. Blocks of the output are accumulated in a local
+		 * array, which can't alias the input rows, a group of taps at a time, with loops
+		 * over contiguous elements (of a fixed length for full blocks) that vectorize.
+		*/
+		template<typename Type>
+		void stencil_row(std::size_t first, std::size_t last, std::vector<stencil_tap<Type>> const& taps, Type* out) {
+			for (std::size_t j = first; j < last; j += stencil_block) {
+				std::array<Type, stencil_block> block{};
+				std::size_t const count = std::min(stencil_block, last - j);
+				for (std::size_t t = 0; t < taps.size(); t += stencil_taps) {
+					stencil_tap<Type> const* const group = taps.data() + t;
+					Type const* const in0 = group[0].row + (std::ptrdiff_t(j) + group[0].shift);
+					Type const* const in1 = group[1].row + (std::ptrdiff_t(j) + group[1].shift);
+					Type const* const in2 = group[2].row + (std::ptrdiff_t(j) + group[2].shift);
+					Type const* const in3 = group[3].row + (std::ptrdiff_t(j) + group[3].shift);
+					Type const w0 = group[0].weight;
+					Type const w1 = group[1].weight;
+					Type const w2 = group[2].weight;
+					Type const w3 = group[3].weight;
+					if (count == stencil_block) {
+						for (std::size_t k = 0; k < stencil_block; ++k) { block[k] += w0 * in0[k] + w1 * in1[k] + w2 * in2[k] + w3 * in3[k]; }
+					} else {
+						for (std::size_t k = 0; k < count; ++k) { block[k] += w0 * in0[k] + w1 * in1[k] + w2 * in2[k] + w3 * in3[k]; }
+					}
+				}
+				std::copy(block.begin(), block.begin() + count, out + j);
+			}
+		}
+
+		/* Computes output plane `o` into `out`, where `source(p)` gives the input plane at
+		 * (possibly out of range) index `p`, or null if it reads as zero. Away from the
+		 * ends of a row every tap reads the input row shifted by a constant, so the
+		 * interior of each row is computed from the list of its nonzero taps; only the
+		 * elements within a kernel radius of the ends go through `boundary_index`.
+		 * `taps` is scratch space.
+		*/
+		template<typename Type, typename Source>
+		void stencil_plane(
+			stencil_shape const& shape, Type const* kernel, std::ptrdiff_t o, Source&& source,
+			std::vector<stencil_tap<Type>>& taps, Type* out
+		) {
+			std::size_t const columns = shape.columns;
+			std::ptrdiff_t const co = std::ptrdiff_t(shape.ko / 2);
+			std::ptrdiff_t const ch = std::ptrdiff_t(shape.kh / 2);
+			std::ptrdiff_t const cw = std::ptrdiff_t(shape.kw / 2);
+			std::size_t const first = std::min(std::size_t(cw), columns);
+			std::size_t const last = std::max(first, columns - first);
+
+			for (std::size_t r = 0; r < shape.rows; ++r) {
+				taps.clear();
+				for (std::size_t a = 0; a < shape.ko; ++a) {
+					Type const* const plane = source(o + std::ptrdiff_t(a) - co);
+					if (plane == nullptr) { continue; }
+					for (std::size_t b = 0; b < shape.kh; ++b) {
+						std::size_t const sr = boundary_index(std::ptrdiff_t(r + b) - ch, shape.rows, shape.mode);
+						if (sr == shape.rows) { continue; }
+						for (std::size_t c = 0; c < shape.kw; ++c) {
+							Type const weight = kernel[(a * shape.kh + b) * shape.kw + c];
+							if (weight != Type()) { taps.push_back({ plane + sr * columns, std::ptrdiff_t(c) - cw, weight }); }
+						}
+					}
+				}
+
+				Type* const row = out + r * columns;
+				std::size_t const count = taps.size();
+				while (taps.size() % stencil_taps != 0) { taps.push_back({ taps.front().row, taps.front().shift, Type() }); }
+				stencil_row(first, last, taps, row);
+				taps.resize(count);
+				std::fill(row, row + first, Type());
+				std::fill(row + last, row + columns, Type());
+				for (auto const& tap : taps) {
+					auto edge = [&](std::size_t j) {
+						std::size_t const sj = boundary_index(std::ptrdiff_t(j) + tap.shift, columns, shape.mode);
+						if (sj != columns) { row[j] += tap.weight * tap.row[sj]; }
+					};
+					for (std::size_t j = 0; j < first; ++j) { edge(j); }
+					for (std::size_t j = last; j < columns; ++j) { edge(j); }
+				}
+			}
+		}
+
+		/* Applies the stencil once, splitting the planes between threads.
+		*/
+		template<typename Type>
+		void stencil_step(stencil_shape const& shape, Type const* kernel, Type const* input, Type* output) {
+			std::size_t const plane = shape.plane();
+			auto source = [&](std::ptrdiff_t p) -> Type const* {
+				std::size_t const index = boundary_index(p, shape.outer, shape.mode);
+				return index == shape.outer ? nullptr : input + index * plane;
+			};
+			parallel_for(shape.outer, std::max<std::size_t>(1, stencil_grain / plane), [&](std::size_t begin, std::size_t end) {
+				std::vector<stencil_tap<Type>> taps;
+				for (std::size_t o = begin; o < end; ++o) { stencil_plane(shape, kernel, std::ptrdiff_t(o), source, taps, output + o * plane); }
+			});
+		}
+
+		/* Advances `input` by `steps` applications of the stencil into `output`, with
+		 * temporal blocking: the planes are split into strips, and each strip copies
+		 * itself and the `steps * ko / 2` planes on each side into a local buffer small
+		 * enough to stay in cache, advances them all `steps` times there (the valid
+		 * planes shrinking from the sides that aren't edges of the tensor at every step),
+		 * and writes back its own planes. The overlap between strips is computed more
+		 * than once, in exchange for reading and writing the tensor once per `steps`
+		 * rather than once per step. Strips run on separate threads.
+		*/
+		template<typename Type>
+		void stencil_blocked(stencil_shape const& shape, Type const* kernel, std::size_t steps, Type const* input, Type* output) {
+			std::size_t const plane = shape.plane();
+			std::size_t const co = shape.ko / 2;
+			std::size_t const halo = steps * co;
+			std::size_t const fit = std::max<std::size_t>(1, stencil_cache_bytes / (2 * plane * sizeof(Type)));
+			std::size_t const strip = std::max<std::size_t>({ fit > 2 * halo ? fit - 2 * halo : 1, 2 * halo, 1 });
+			std::size_t const strips = (shape.outer + strip - 1) / strip;
+			bool const periodic = shape.mode == boundary::periodic;
+
+			parallel_for(strips, 1, [&](std::size_t first, std::size_t last) {
+				std::vector<Type> buffers;
+				std::vector<stencil_tap<Type>> taps;
+				for (std::size_t s = first; s < last; ++s) {
+					std::ptrdiff_t const begin = std::ptrdiff_t(s * strip);
+					std::ptrdiff_t const end = std::ptrdiff_t(std::min(shape.outer, (s + 1) * strip));
+					std::ptrdiff_t low = begin - std::ptrdiff_t(halo);
+					std::ptrdiff_t high = end + std::ptrdiff_t(halo);
+					bool const low_edge = !periodic && low <= 0;
+					bool const high_edge = !periodic && high >= std::ptrdiff_t(shape.outer);
+					if (low_edge) { low = 0; }
+					if (high_edge) { high = std::ptrdiff_t(shape.outer); }
+					std::size_t const count = std::size_t(high - low);
+
+					buffers.resize(2 * count * plane);
+					Type* current = buffers.data();
+					Type* next = current + count * plane;
+					for (std::ptrdiff_t p = low; p < high; ++p) {
+						Type const* const from = input + boundary_index(p, shape.outer, shape.mode) * plane;
+						std::copy(from, from + plane, current + std::size_t(p - low) * plane);
+					}
+
+					for (std::size_t t = 1; t <= steps; ++t) {
+						Type const* const previous = current;
+						auto source = [&](std::ptrdiff_t p) -> Type const* {
+							if (p >= low && p < high) { return previous + std::size_t(p - low) * plane; }
+							std::size_t const index = boundary_index(p, shape.outer, shape.mode);
+							return index == shape.outer ? nullptr : previous + std::size_t(std::ptrdiff_t(index) - low) * plane;
+						};
+						std::ptrdiff_t const shrink = std::ptrdiff_t(t * co);
+						std::ptrdiff_t const from = low_edge ? low : low + shrink;
+						std::ptrdiff_t const to = high_edge ? high : high - shrink;
+						for (std::ptrdiff_t p = from; p < to; ++p) {
+							stencil_plane(shape, kernel, p, source, taps, next + std::size_t(p - low) * plane);
+						}
+						std::swap(current, next);
+					}
+
+					std::copy(current + std::size_t(begin - low) * plane, current + std::size_t(end - low) * plane, output + std::size_t(begin) * plane);
+				}
+			});
+		}
+
+		/* Applies the stencil `steps` times, a temporal block at a time, alternating
+		 * between `output` and a temporary tensor so that the last block writes `output`.
+		*/
+		template<typename Type>
+		void stencil_apply(stencil_shape const& shape, Type const* kernel, std::size_t steps, Type const* input, Type* output) {
+			if (steps == 0) {
+				std::copy(input, input + shape.outer * shape.plane(), output);
+				return;
+			}
+			std::size_t const blocks = (steps + stencil_time_block - 1) / stencil_time_block;
+			std::vector<Type> temporary(blocks > 1 ? shape.outer * shape.plane() : 0);
+			Type const* from = input;
+			for (std::size_t block = 0; block < blocks; ++block) {
+				Type* const to = (blocks - 1 - block) % 2 == 0 ? output : temporary.data();
+				std::size_t const advance = std::min(stencil_time_block, steps - block * stencil_time_block);
+				if (advance == 1) {
+					stencil_step(shape, kernel, from, to);
+				} else {
+					stencil_blocked(shape, kernel, advance, from, to);
+				}
+				from = to;
+			}
+		}
+
+		/* Copies the weights of a kernel into the type of the tensor, reversing them for
+		 * a convolution.
+		*/
+		template<typename Type, std::size_t Size, typename Weight>
+		std::array<Type, Size> kernel_weights(Weight const* weights, bool flip) {
+			std::array<Type, Size> result;
+			for (std::size_t i = 0; i < Size; ++i) { result[i] = Type(weights[flip ? Size - 1 - i : i]); }
+			return result;
+		}
+
+	}
+
+	/* Applies a stencil `steps` times: each element becomes the sum of its neighbours
+	 * weighted by `weights`, which is centered on it and must have odd extents. Elements
+	 * beyond the edges are read as described by `mode`. Zero weights cost nothing, so
+	 * for example the 5-point Laplacian is
+	 * 		sor::matrix<float, 3, 3> laplacian({
+	 * 			0, 1, 0,
+	 * 			1, -4, 1,
+	 * 			0, 1, 0
+	 * 		});
+	 * 		auto result = sor::stencil_apply(grid, laplacian);
+	 * Repeated steps are temporally blocked, and planes are split between threads.
+	*/
+	template<typename Type, std::size_t H, std::size_t W, typename Weight, std::size_t KH, std::size_t KW>
+	tensor<Type, H, W> stencil_apply(
+		tensor<Type, H, W> const& input, tensor<Weight, KH, KW> const& weights, boundary mode = boundary::zero, std::size_t steps = 1
+	) {
+		static_assert(KH % 2 == 1 && KW % 2 == 1, "stencils must have odd extents");
+		auto const kernel = detail::kernel_weights<Type, KH * KW>(weights.data(), false);
+		tensor<Type, H, W> result;
+		detail::stencil_apply(detail::stencil_shape{ H, 1, W, KH, 1, KW, mode }, kernel.data(), steps, input.data(), result.data());
+		return result;
+	}
+
+	template<typename Type, std::size_t D, std::size_t H, std::size_t W, typename Weight, std::size_t KD, std::size_t KH, std::size_t KW>
+	tensor<Type, D, H, W> stencil_apply(
+		tensor<Type, D, H, W> const& input, tensor<Weight, KD, KH, KW> const& weights, boundary mode = boundary::zero, std::size_t steps = 1
+	) {
+		static_assert(KD % 2 == 1 && KH % 2 == 1 && KW % 2 == 1, "stencils must have odd extents");
+		auto const kernel = detail::kernel_weights<Type, KD * KH * KW>(weights.data(), false);
+		tensor<Type, D, H, W> result;
+		detail::stencil_apply(detail::stencil_shape{ D, H, W, KD, KH, KW, mode }, kernel.data(), steps, input.data(), result.data());
+		return result;
+	}
+
+	/* Convolution of a tensor with a kernel of odd extents, with the output the same
+	 * shape as the input: a stencil with the kernel reversed along every axis.
+	*/
+	template<typename Type, std::size_t H, std::size_t W, typename Weight, std::size_t KH, std::size_t KW>
+	tensor<Type, H, W> convolve(tensor<Type, H, W> const& input, tensor<Weight, KH, KW> const& kernel, boundary mode = boundary::zero) {
+		static_assert(KH % 2 == 1 && KW % 2 == 1, "kernels must have odd extents");
+		auto const weights = detail::kernel_weights<Type, KH * KW>(kernel.data(), true);
+		tensor<Type, H, W> result;
+		detail::stencil_apply(detail::stencil_shape{ H, 1, W, KH, 1, KW, mode }, weights.data(), 1, input.data(), result.data());
+		return result;
+	}
+
+	template<typename Type, std::size_t D, std::size_t H, std::size_t W, typename Weight, std::size_t KD, std::size_t KH, std::size_t KW>
+	tensor<Type, D, H, W> convolve(tensor<Type, D, H, W> const& input, tensor<Weight, KD, KH, KW> const& kernel, boundary mode = boundary::zero) {
+		static_assert(KD % 2 == 1 && KH % 2 == 1 && KW % 2 == 1, "kernels must have odd extents");
+		auto const weights = detail::kernel_weights<Type, KD * KH * KW>(kernel.data(), true);
+		tensor<Type, D, H, W> result;
+		detail::stencil_apply(detail::stencil_shape{ D, H, W, KD, KH, KW, mode }, weights.data(), 1, input.data(), result.data());
+		return result;
+	}
+
+}
\ No newline at end of file
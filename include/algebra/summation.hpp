@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+namespace sor {
+
+	/* Accuracy policy of the sums computed by `dot_product`, `euclidean_norm`, `sum`
+	 * and `mean`:
+	 * - `naive` adds the terms in a single pass, and its rounding error can grow
+	 *   linearly with their number;
+	 * - `pairwise` sums blocks of terms in independent SIMD lanes and adds the block
+	 *   sums along a balanced tree, so that the error grows with the logarithm of
+	 *   the number of terms at about the cost of the naive sum;
+	 * - `kahan_babuska` carries the rounding error of every addition in a separate
+	 *   compensation (Neumaier's variant of Kahan summation), so that the error
+	 *   doesn't depend on the number of terms, at about four times the additions.
+	 * Integer sums are exact, and the same with every policy. Element types other
+	 * than the built in arithmetic ones, such as complex numbers, have no ordering to
+	 * pick the larger operand by, and are summed without compensation.
+	*/
+	enum class summation { naive, pairwise, kahan_babuska };
+
+	/* Implementation details.
+	*/
+	namespace detail {
+
+		/* Independent accumulators of the pairwise and compensated kernels, and number
+		 * of terms summed by the leaves of the pairwise tree.
+		*/
+		constexpr std::size_t summation_lanes = 8;
+		constexpr std::size_t pairwise_block = 128;
+
+		/* Sum of `term(i)` for `i` in `[begin, begin + size)`, in `summation_lanes`
+		 * interleaved accumulators. Full blocks take a loop with a constant trip count,
+		 * which vectorizes.
+		*/
+		template<typename Result, typename Term>
+		constexpr Result lane_sum(std::size_t begin, std::size_t size, Term const& term) {
+			Result partial[summation_lanes] = {};
+			std::size_t i = 0;
+			if (size == pairwise_block) {
+				for (; i < pairwise_block; i += summation_lanes) {
+					for (std::size_t j = 0; j < summation_lanes; ++j) { partial[j] += term(begin + i + j); }
+				}
+			} else {
+				for (; i + summation_lanes <= size; i += summation_lanes) {
+					for (std::size_t j = 0; j < summation_lanes; ++j) { partial[j] += term(begin + i + j); }
+				}
+			}
+			for (std::size_t j = 0; i + j < size; ++j) { partial[j] += term(begin + i + j); }
+			for (std::size_t width = summation_lanes / 2; width > 0; width /= 2) {
+				for (std::size_t j = 0; j < width; ++j) { partial[j] += partial[j + width]; }
+			}
+			return partial[0];
+		}
+
+		/* Pairwise sum of `term(i)` for `i` in `[begin, begin + size)`: the range is
+		 * halved, on a block boundary, until it fits in a block.
+		*/
+		template<typename Result, typename Term>
+		constexpr Result pairwise_sum(std::size_t begin, std::size_t size, Term const& term) {
+			if (size <= pairwise_block) { return lane_sum<Result>(begin, size, term); }
+			std::size_t const blocks = (size + pairwise_block - 1) / pairwise_block;
+			std::size_t const half = blocks / 2 * pairwise_block;
+			return pairwise_sum<Result>(begin, half, term) + pairwise_sum<Result>(begin + half, size - half, term);
+		}
+
+		/* Adds `value` to `sum`, accumulating the rounding error of the addition into
+		 * `compensation`, whichever of the two operands is larger.
+		*/
+		template<typename Result>
+		constexpr void compensated_add(Result& sum, Result& compensation, Result const& value) {
+			if constexpr (std::is_arithmetic<Result>::value) {
+				Result const total = sum + value;
+				bool const larger = (sum < Result() ? -sum : sum) >= (value < Result() ? -value : value);
+				Result const big = larger ? sum : value;
+				Result const small = larger ? value : sum;
+				compensation += (big - total) + small;
+				sum = total;
+			} else {
+				sum += value;
+			}
+		}
+
+		/* Compensated sum. Once the sum is infinite the compensation is `inf - inf`, so
+		 * the sum is returned alone, as the naive and pairwise sums would.
+		*/
+		template<typename Result>
+		constexpr Result compensated_total(Result const& sum, Result const& compensation) {
+			if constexpr (std::is_floating_point<Result>::value) {
+				if (!(sum - sum == Result())) { return sum; }
+			}
+			return sum + compensation;
+		}
+
+		/* Kahan-Babuška sum of `term(i)` for `i` in `[0, size)`, over interleaved lanes
+		 * whose sums and compensations are combined at the end. Full blocks take a loop
+		 * with a constant trip count, as in `lane_sum`.
+		*/
+		template<typename Result, typename Term>
+		constexpr Result compensated_sum(std::size_t size, Term const& term) {
+			Result sums[summation_lanes] = {};
+			Result compensations[summation_lanes] = {};
+			std::size_t i = 0;
+			for (; i + pairwise_block <= size; i += pairwise_block) {
+				for (std::size_t k = i; k < i + pairwise_block; k += summation_lanes) {
+					for (std::size_t j = 0; j < summation_lanes; ++j) { compensated_add(sums[j], compensations[j], Result(term(k + j))); }
+				}
+			}
+			for (; i + summation_lanes <= size; i += summation_lanes) {
+				for (std::size_t j = 0; j < summation_lanes; ++j) { compensated_add(sums[j], compensations[j], Result(term(i + j))); }
+			}
+			for (std::size_t j = 0; i + j < size; ++j) { compensated_add(sums[j], compensations[j], Result(term(i + j))); }
+			Result sum{}, compensation{};
+			for (std::size_t j = 0; j < summation_lanes; ++j) {
+				compensated_add(sum, compensation, sums[j]);
+				compensation += compensations[j];
+			}
+			return compensated_total(sum, compensation);
+		}
+
+		/* Sum of `term(i)` for `i` in `[0, size)` with the given policy; the naive sum
+		 * adds the terms in order.
+		*/
+		template<typename Result, typename Term>
+		constexpr Result accumulate(std::size_t size, summation mode, Term const& term) {
+			switch (mode) {
+				case summation::pairwise:
+					return pairwise_sum<Result>(0, size, term);
+				case summation::kahan_babuska:
+					return compensated_sum<Result>(size, term);
+				default: {
+					Result result{};
+					for (std::size_t i = 0; i < size; ++i) { result += term(i); }
+					return result;
+				}
+			}
+		}
+
+	}
+
+}
\ No newline at end of file
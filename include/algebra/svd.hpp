@@ -0,0 +1,324 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <utility>
+#include <type_traits>
+
+#include "../vector.hpp"
+#include "../matrix.hpp"
+#include "../detail/gemm.hpp"
+#include "../detail/parallel.hpp"
+#include "../detail/permute.hpp"
+#include "qr.hpp"
+
+namespace sor {
+
+	/* Result of `svd` and `truncated_svd`: `A = U * diag(singular_values) * V^T`,
+	 * restricted to the `K` largest singular values, in descending order. The columns
+	 * of `u` and `v` are orthonormal, except for those of zero singular values, which
+	 * are zero. The decomposition is only meaningful if the Jacobi iteration
+	 * `converged`.
+	*/
+	template<typename Type, std::size_t M, std::size_t N, std::size_t K>
+	struct svd_decomposition {
+		matrix<Type, M, K> u;
+		vector<Type, K> singular_values;
+		matrix<Type, N, K> v;
+		bool converged;
+	};
+
+	/* Implementation details.
+	*/
+	namespace detail {
+
+		/* Maximum number of sweeps of the one-sided Jacobi method.
+		*/
+		constexpr std::size_t svd_sweeps = 30;
+
+		/* Minimum number of elements of the columns rotated by each thread during a
+		 * round of the one-sided Jacobi method: smaller rounds run on a single thread.
+		*/
+		constexpr std::size_t svd_parallel_work = std::size_t(1) << 15;
+
+		/* Number of extra random directions sampled by `truncated_svd`.
+		*/
+		constexpr std::size_t svd_oversampling = 8;
+
+		/* Rotates the `m` elements long `wp` and `wq` so that they become orthogonal,
+		 * applying the same rotation to the `n` elements long `vp` and `vq`. Returns
+		 * false if they already were orthogonal to working precision.
+		*/
+		template<typename Type>
+		bool jacobi_rotate(Type* wp, Type* wq, std::size_t m, Type* vp, Type* vq, std::size_t n) {
+			Type alpha = Type(), beta = Type(), gamma = Type();
+			for (std::size_t k = 0; k < m; ++k) {
+				alpha += wp[k] * wp[k];
+				beta += wq[k] * wq[k];
+				gamma += wp[k] * wq[k];
+			}
+			if (!(std::abs(gamma) > std::numeric_limits<Type>::epsilon() * std::sqrt(alpha * beta))) { return false; }
+
+			Type const zeta = (beta - alpha) / (2 * gamma);
+			Type const t = std::copysign(Type(1), zeta) / (std::abs(zeta) + std::hypot(Type(1), zeta));
+			Type const c = 1 / std::sqrt(1 + t * t);
+			Type const s = c * t;
+			for (std::size_t k = 0; k < m; ++k) {
+				Type const x = wp[k], y = wq[k];
+				wp[k] = c * x - s * y;
+				wq[k] = s * x + c * y;
+			}
+			for (std::size_t k = 0; k < n; ++k) {
+				Type const x = vp[k], y = vq[k];
+				vp[k] = c * x - s * y;
+				vq[k] = s * x + c * y;
+			}
+			return true;
+		}
+
+		/* One-sided Jacobi SVD of the `m` x `n` matrix whose columns are the rows of the
+		 * row major `w`. On return the rows of `w` are the left singular vectors, the
+		 * rows of the `n` x `n` `vt` are the right ones and `sigma` holds the singular
+		 * values, in descending order.
+		 * Each sweep visits every pair of columns in `n - 1` rounds of disjoint pairs
+		 * (ordered as a round robin tournament), so the pairs of a round are rotated in
+		 * parallel.
+		*/
+		template<typename Type>
+		bool jacobi_svd(Type* w, std::size_t n, std::size_t m, Type* vt, Type* sigma) {
+			for (std::size_t i = 0; i < n; ++i) {
+				for (std::size_t j = 0; j < n; ++j) { vt[i * n + j] = i == j ? Type(1) : Type(); }
+			}
+
+			std::size_t const players = n + (n & 1);
+			std::size_t const pairs = players / 2;
+			std::size_t const grain = m >= svd_parallel_work ? 1 : svd_parallel_work / (m + 1);
+			bool converged = n < 2;
+			for (std::size_t sweep = 0; sweep < svd_sweeps && !converged; ++sweep) {
+				std::atomic<bool> rotated(false);
+				for (std::size_t round = 0; round + 1 < players; ++round) {
+					auto player = [players, round](std::size_t position) {
+						return position == 0 ? 0 : (position - 1 + round) % (players - 1) + 1;
+					};
+					parallel_for(pairs, grain, [&](std::size_t first, std::size_t last) {
+						bool any = false;
+						for (std::size_t k = first; k < last; ++k) {
+							std::size_t const p = player(k), q = player(players - 1 - k);
+							if (p >= n || q >= n) { continue; }
+							any = jacobi_rotate(w + p * m, w + q * m, m, vt + p * n, vt + q * n, n) || any;
+						}
+						if (any) { rotated.store(true, std::memory_order_relaxed); }
+					});
+				}
+				converged = !rotated.load(std::memory_order_relaxed);
+			}
+
+			for (std::size_t j = 0; j < n; ++j) {
+				Type* const row = w + j * m;
+				Type norm = Type();
+				for (std::size_t k = 0; k < m; ++k) { norm += row[k] * row[k]; }
+				sigma[j] = norm = std::sqrt(norm);
+				if (norm > Type()) {
+					for (std::size_t k = 0; k < m; ++k) { row[k] /= norm; }
+				}
+			}
+			for (std::size_t i = 0; i < n; ++i) {
+				std::size_t largest = i;
+				for (std::size_t j = i + 1; j < n; ++j) {
+					if (sigma[j] > sigma[largest]) { largest = j; }
+				}
+				if (largest != i) {
+					std::swap(sigma[i], sigma[largest]);
+					for (std::size_t k = 0; k < m; ++k) { std::swap(w[i * m + k], w[largest * m + k]); }
+					for (std::size_t k = 0; k < n; ++k) { std::swap(vt[i * n + k], vt[largest * n + k]); }
+				}
+			}
+			return converged;
+		}
+
+		/* Number of elements of the workspace of `randomized_svd`.
+		*/
+		inline std::size_t randomized_svd_workspace(std::size_t m, std::size_t n, std::size_t l) noexcept {
+			std::size_t const qr = householder_qr_workspace(m > n ? m : n, l);
+			return 3 * n * l + 3 * m * l + 2 * l * l + 2 * l + qr;
+		}
+
+		/* Replaces the `rows` x `columns` row major `q` with an orthonormal basis of the
+		 * span of its columns, computed by a QR decomposition in `scratch`, which must
+		 * hold as many elements as `q`. `tau` must hold `columns` elements and `work`
+		 * enough for `householder_qr`.
+		*/
+		template<typename Type>
+		void orthonormalize(Type* q, std::size_t rows, std::size_t columns, Type* scratch, Type* tau, Type* work) {
+			for (std::size_t i = 0; i < rows * columns; ++i) { scratch[i] = q[i]; }
+			householder_qr(scratch, rows, columns, columns, tau, work);
+			householder_q(scratch, rows, columns, columns, tau, q, work);
+		}
+
+		/* Randomized SVD of the `m` x `n` row major `a`, keeping its `k` largest singular
+		 * values out of the `l` computed. The range of `a` is sampled by `l` random
+		 * directions and refined by `iterations` steps of subspace iteration; the SVD
+		 * of `a` projected onto that range is then computed by the Jacobi method.
+		*/
+		template<typename Type>
+		bool randomized_svd(
+			Type const* a, std::size_t m, std::size_t n, std::size_t k, std::size_t l,
+			std::size_t iterations, std::vector<Type>& workspace,
+			Type* u, Type* sigma, Type* v
+		) {
+			workspace.resize(randomized_svd_workspace(m, n, l));
+			Type* const omega = workspace.data();
+			Type* const z = omega + n * l;
+			Type* const b = z + n * l;
+			Type* const y = b + n * l;
+			Type* const qt = y + m * l;
+			Type* const scratch = qt + m * l;
+			Type* const vt = scratch + m * l;
+			Type* const vc = vt + l * l;
+			Type* const tau = vc + l * l;
+			Type* const s = tau + l;
+			Type* const work = s + l;
+
+			// Uniform random directions in [-1, 1), from a fixed xorshift sequence.
+			std::uint64_t state = 0x9E3779B97F4A7C15ull;
+			for (std::size_t i = 0; i < n * l; ++i) {
+				state ^= state << 13;
+				state ^= state >> 7;
+				state ^= state << 17;
+				omega[i] = Type(double(state >> 11) * (2.0 / 9007199254740992.0) - 1.0);
+			}
+
+			auto multiply = [&](Type const* right) {
+				for (std::size_t i = 0; i < m * l; ++i) { y[i] = Type(); }
+				gemm(m, l, n, Type(1), a, n, right, l, y, l);
+			};
+			auto project = [&] {
+				orthonormalize(y, m, l, scratch, tau, work);
+				transpose(y, m, l, qt);
+				for (std::size_t i = 0; i < l * n; ++i) { b[i] = Type(); }
+				gemm(l, n, m, Type(1), qt, m, a, n, b, n);
+			};
+
+			multiply(omega);
+			for (std::size_t i = 0; i < iterations; ++i) {
+				project();
+				transpose(b, l, n, omega);
+				orthonormalize(omega, n, l, z, tau, work);
+				multiply(omega);
+			}
+			project();
+
+			// B = Q^T * A, so the SVD of A is Q times the SVD of B.
+			bool const converged = jacobi_svd(b, l, n, vt, s);
+			transpose(vt, l, l, vc);
+			for (std::size_t i = 0; i < m * l; ++i) { scratch[i] = Type(); }
+			gemm(m, l, l, Type(1), y, l, vc, l, scratch, l);
+
+			for (std::size_t j = 0; j < k; ++j) { sigma[j] = s[j]; }
+			for (std::size_t i = 0; i < m; ++i) {
+				for (std::size_t j = 0; j < k; ++j) { u[i * k + j] = scratch[i * l + j]; }
+			}
+			for (std::size_t i = 0; i < n; ++i) {
+				for (std::size_t j = 0; j < k; ++j) { v[i * k + j] = b[j * n + i]; }
+			}
+			return converged;
+		}
+
+	}
+
+	/* Singular value decomposition, by the one-sided Jacobi method.
+	 * Note: The rotations within each sweep are spread over the available threads
+	 * when the matrix is large enough. No memory is allocated besides the result and
+	 * a copy of the matrix, both on the stack.
+	 * Example:
+	 * 		sor::matrix<float, 6, 4> a;
+	 * 		auto decomposition = sor::svd(a); // K = 4
+	*/
+	template<typename Type, std::size_t M, std::size_t N>
+	svd_decomposition<Type, M, N, (M < N ? M : N)> svd(matrix<Type, M, N> const& a) {
+		static_assert(std::is_floating_point<Type>::value, "SVD requires floating point elements");
+		constexpr std::size_t K = M < N ? M : N;
+		constexpr std::size_t L = M < N ? N : M;
+
+		svd_decomposition<Type, M, N, K> result;
+		matrix<Type, K, L> w;
+		matrix<Type, K, K> vt;
+		if constexpr (M < N) {
+			for (std::size_t i = 0; i < M * N; ++i) { w.data()[i] = a.data()[i]; }
+		} else {
+			detail::transpose(a.data(), M, N, w.data());
+		}
+		result.converged = detail::jacobi_svd(w.data(), K, L, vt.data(), result.singular_values.data());
+
+		// Decomposing `A^T` instead of `A` swaps the roles of the singular vectors.
+		Type* const left = M < N ? result.v.data() : result.u.data();
+		Type* const right = M < N ? result.u.data() : result.v.data();
+		detail::transpose(w.data(), K, L, left);
+		detail::transpose(vt.data(), K, K, right);
+		return result;
+	}
+
+	/* Randomized SVD, keeping only the `K` largest singular values.
+	 * `workspace` is resized as needed, so reusing it across calls avoids allocating
+	 * memory. More `power_iterations` improve the accuracy for matrices whose singular
+	 * values decay slowly.
+	 * Example:
+	 * 		static sor::matrix<float, 2000, 500> a;
+	 * 		std::vector<float> workspace;
+	 * 		auto top = sor::truncated_svd<10>(a, workspace);
+	*/
+	template<std::size_t K, typename Type, std::size_t M, std::size_t N>
+	svd_decomposition<Type, M, N, K> truncated_svd(
+		matrix<Type, M, N> const& a,
+		std::vector<Type>& workspace,
+		std::size_t power_iterations = 2
+	) {
+		static_assert(std::is_floating_point<Type>::value, "SVD requires floating point elements");
+		constexpr std::size_t rank = M < N ? M : N;
+		static_assert(K <= rank, "cannot keep more singular values than the matrix has");
+		constexpr std::size_t L = K + detail::svd_oversampling < rank ? K + detail::svd_oversampling : rank;
+
+		svd_decomposition<Type, M, N, K> result;
+		result.converged = detail::randomized_svd(
+			a.data(), M, N, K, L, power_iterations, workspace,
+			result.u.data(), result.singular_values.data(), result.v.data()
+		);
+		return result;
+	}
+
+	template<std::size_t K, typename Type, std::size_t M, std::size_t N>
+	svd_decomposition<Type, M, N, K> truncated_svd(matrix<Type, M, N> const& a, std::size_t power_iterations = 2) {
+		std::vector<Type> workspace;
+		return truncated_svd<K>(a, workspace, power_iterations);
+	}
+
+	/* Moore-Penrose pseudo inverse, through the SVD. Singular values smaller than
+	 * `max(M, N) * epsilon` times the largest one are treated as zero.
+	*/
+	template<typename Type, std::size_t M, std::size_t N>
+	matrix<Type, N, M> pseudo_inverse(matrix<Type, M, N> const& a) {
+		constexpr std::size_t K = M < N ? M : N;
+		auto const decomposition = svd(a);
+		Type const cutoff = Type(M < N ? N : M) * std::numeric_limits<Type>::epsilon()
+			* (K == 0 ? Type() : decomposition.singular_values[0]);
+
+		// V * S^+ is computed in place of V, then multiplied by U^T.
+		matrix<Type, N, K> scaled = decomposition.v;
+		for (std::size_t j = 0; j < K; ++j) {
+			Type const value = decomposition.singular_values[j];
+			Type const inverse = value > cutoff ? 1 / value : Type();
+			for (std::size_t i = 0; i < N; ++i) { scaled(i, j) *= inverse; }
+		}
+		matrix<Type, K, M> ut;
+		detail::transpose(decomposition.u.data(), M, K, ut.data());
+		matrix<Type, N, M> result{};
+		detail::gemm(N, M, K, Type(1), scaled.data(), K, ut.data(), M, result.data(), M);
+		return result;
+	}
+
+}
\ No newline at end of file
@@ -2,11 +2,12 @@
 
 #include <type_traits>
 #include <algorithm>
-#include <numeric>
 #include <cassert>
+#include <cmath>
 
 #include "../vector.hpp"
 #include "common.hpp"
+#include "summation.hpp"
 
 namespace sor {
 
@@ -14,44 +15,48 @@ namespace sor {
 	*/
 	template<typename Type, std::size_t N,
 		typename std::enable_if<(N > 0), int>::type = 0>
-	auto& x(vector<Type, N>& vector) { return vector[0]; }
+	constexpr auto& x(vector<Type, N>& vector) { return vector[0]; }
 
 	template<typename Type, std::size_t N,
 		typename std::enable_if<(N > 0), int>::type = 0>
-	auto& x(vector<Type, N> const& vector) { return vector[0]; }
+	constexpr auto& x(vector<Type, N> const& vector) { return vector[0]; }
 
 	template<typename Type, std::size_t N,
 		typename std::enable_if<(N > 1), int>::type = 0>
-	auto& y(vector<Type, N>& vector) { return vector[1]; }
+	constexpr auto& y(vector<Type, N>& vector) { return vector[1]; }
 
 	template<typename Type, std::size_t N,
 		typename std::enable_if<(N > 1), int>::type = 0>
-	auto& y(vector<Type, N> const& vector) { return vector[1]; }
+	constexpr auto& y(vector<Type, N> const& vector) { return vector[1]; }
 
 	template<typename Type, std::size_t N,
 		typename std::enable_if<(N > 2), int>::type = 0>
-	auto& z(vector<Type, N>& vector) { return vector[2]; }
+	constexpr auto& z(vector<Type, N>& vector) { return vector[2]; }
 
 	template<typename Type, std::size_t N,
 		typename std::enable_if<(N > 2), int>::type = 0>
-	auto& z(vector<Type, N> const& vector) { return vector[2]; }
+	constexpr auto& z(vector<Type, N> const& vector) { return vector[2]; }
 
 	template<typename Type, std::size_t N,
 		typename std::enable_if<(N > 3), int>::type = 0>
-	auto& w(vector<Type, N>& vector) { return vector[3]; }
+	constexpr auto& w(vector<Type, N>& vector) { return vector[3]; }
 
 	template<typename Type, std::size_t N,
 		typename std::enable_if<(N > 3), int>::type = 0>
-	auto& w(vector<Type, N> const& vector) { return vector[3]; }
+	constexpr auto& w(vector<Type, N> const& vector) { return vector[3]; }
 
 	/* Euclidean norm (magnitude).
-	 * The euclidean norm is the length of a vector.
+	 * The euclidean norm is the length of a vector. The squares are summed in the
+	 * `sor::accumulation_type` of the elements, with the given `sor::summation`
+	 * policy.
 	*/
 	template<typename Type, std::size_t N>
-	Type euclidean_norm(vector<Type, N> const& vec) {
-		auto acc_fn = [](Type const& init, Type const& curr) { return init + std::pow(curr, 2); };
-		auto sum = std::accumulate(vec.begin(), vec.end(), Type(), acc_fn);
-		return std::sqrt(sum);
+	Type euclidean_norm(vector<Type, N> const& vec, summation mode = summation::naive) {
+		using accumulator = typename accumulation_type<Type>::type;
+		auto const squares = detail::accumulate<accumulator>(N, mode, [&](std::size_t i) {
+			return accumulator(vec[i]) * accumulator(vec[i]);
+		});
+		return std::sqrt(squares);
 	}
 
 	/* Euclidean distance.
@@ -73,16 +78,32 @@ namespace sor {
 	}
 
 	/* Dot product.
+	 * The products are summed in the `sor::accumulation_type` of the common type of
+	 * the elements, which is also the type of the result, with the given
+	 * `sor::summation` policy.
+	 * Example:
+	 * 		sor::vector<float, 100000> weights, inputs;
+	 * 		float y = sor::dot_product(weights, inputs, sor::summation::pairwise);
 	*/
 	template<typename LhsType, typename RhsType, std::size_t N>
-	auto dot_product(vector<LhsType, N> const& lhs, vector<RhsType, N> const& rhs) {
-		using result_type = typename std::common_type<LhsType, RhsType>::type;
-		result_type result{};
+	constexpr auto dot_product(vector<LhsType, N> const& lhs, vector<RhsType, N> const& rhs, summation mode = summation::naive) {
+		using result_type = typename accumulation_type<typename std::common_type<LhsType, RhsType>::type>::type;
+		return detail::accumulate<result_type>(N, mode, [&](std::size_t i) { return lhs[i] * rhs[i]; });
+	}
 
-		auto lit = lhs.cbegin();
-		auto rit = rhs.cbegin();
-		for (; lit < lhs.cend() && rit < rhs.cend(); ++lit, ++rit) {
-			result += (*lit) * (*rit);
+	/* Cross product of three dimensional vectors, in the lane permuted form
+	 * `lhs.yzx * rhs.zxy - lhs.zxy * rhs.yzx`: each component is the same expression
+	 * on rotated operands, so the compiler can keep the vectors in registers and
+	 * compute all three components with two products and a subtraction.
+	*/
+	template<typename LhsType, typename RhsType>
+	constexpr auto cross_product(vector<LhsType, 3> const& lhs, vector<RhsType, 3> const& rhs) {
+		using result_type = typename std::common_type<LhsType, RhsType>::type;
+		vector<result_type, 3> result{};
+		for (std::size_t i = 0; i < 3; ++i) {
+			std::size_t const next = (i + 1) % 3;
+			std::size_t const last = (i + 2) % 3;
+			result[i] = result_type(lhs[next]) * rhs[last] - result_type(lhs[last]) * rhs[next];
 		}
 		return result;
 	}
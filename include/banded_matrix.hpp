@@ -0,0 +1,175 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+
+#include "type_traits.hpp"
+#include "matrix.hpp"
+
+namespace sor {
+
+	/* Square matrix whose elements are zero outside of a band of `KL` diagonals below
+	 * the main one and `KU` above it. The band is stored a row at a time, `KL + KU + 1`
+	 * elements per row starting from column `i - KL`, so that each row is contiguous;
+	 * the positions of the first and last rows that fall outside of the matrix are
+	 * unused.
+	 * Example:
+	 * 		sor::tridiagonal_matrix<double, 4> t;
+	 * 		for (std::size_t i = 0; i < 4; ++i) { t(i, i) = 2; }
+	 * 		for (std::size_t i = 1; i < 4; ++i) { t(i, i - 1) = t(i - 1, i) = -1; }
+	*/
+	template<typename Type, std::size_t N, std::size_t KL, std::size_t KU>
+	struct banded_matrix {
+
+	private:
+
+		using container_type = std::array<Type, N * (KL + KU + 1)>;
+
+		container_type array;
+
+	public:
+
+		/* Type definitions
+		*/
+		using value_type = typename container_type::value_type;
+
+		using reference = typename container_type::reference;
+		using const_reference = typename container_type::const_reference;
+
+		using pointer = typename container_type::pointer;
+		using const_pointer = typename container_type::const_pointer;
+
+		using size_type = std::size_t;
+
+		/* Number of stored elements in each row.
+		*/
+		static constexpr size_type width = KL + KU + 1;
+
+		/* Regular copy and move constructors work as you would expect; the default one
+		 * gives a zero matrix.
+		*/
+		constexpr banded_matrix() noexcept(std::is_nothrow_default_constructible<Type>::value)
+			: array() {}
+		banded_matrix(banded_matrix const&) = default;
+		banded_matrix(banded_matrix&&) = default;
+
+		banded_matrix& operator=(banded_matrix const&) = default;
+		banded_matrix& operator=(banded_matrix&&) = default;
+
+		/* Initializes the band storage in order, `width` elements per row, including the
+		 * unused positions. Elements past the end are ignored and missing ones are value
+		 * initialized.
+		*/
+		template<typename OtherType>
+		constexpr explicit banded_matrix(std::initializer_list<OtherType> const& list)
+				noexcept(std::is_nothrow_assignable<Type, OtherType>::value)
+			: array() {
+			auto it = list.begin();
+			for (std::size_t i = 0; i < array.size() && it != list.end(); ++i, ++it) {
+				array[i] = *it;
+			}
+		}
+
+		/* Copies the band of a dense matrix; the other elements are ignored.
+		*/
+		template<typename OtherType>
+		constexpr explicit banded_matrix(matrix<OtherType, N, N> const& dense)
+				noexcept(std::is_nothrow_assignable<Type, OtherType>::value)
+			: array() {
+			for (std::size_t i = 0; i < N; ++i) {
+				for (std::size_t j = 0; j < N; ++j) {
+					if (stored(i, j)) { array[index(i, j)] = dense(i, j); }
+				}
+			}
+		}
+
+		/* Underlying data access.
+		*/
+		constexpr pointer data() noexcept { return array.data(); }
+		constexpr const_pointer data() const noexcept { return array.data(); }
+
+		/* Whether element `(i, j)` is in the band, rather than known to be zero.
+		*/
+		static constexpr bool stored(std::size_t i, std::size_t j) noexcept {
+			return j + KL >= i && j <= i + KU;
+		}
+
+		/* Position of element `(i, j)` of the band in the storage.
+		*/
+		static constexpr std::size_t index(std::size_t i, std::size_t j) noexcept {
+			return i * width + (j + KL - i);
+		}
+
+		/* Element access operator. Only elements in the band can be assigned to; reading
+		 * the others gives zero.
+		*/
+		constexpr Type& operator()(std::size_t i, std::size_t j) noexcept {
+			assert(stored(i, j));
+			return array[index(i, j)];
+		}
+
+		constexpr Type operator()(std::size_t i, std::size_t j) const noexcept {
+			return stored(i, j) ? array[index(i, j)] : Type();
+		}
+
+		/* Number of elements of the band storage.
+		*/
+		constexpr size_type size() const noexcept {
+			return array.size();
+		}
+
+	};
+
+	/* Banded matrix with a single diagonal on each side of the main one.
+	*/
+	template<typename Type, std::size_t N>
+	using tridiagonal_matrix = banded_matrix<Type, N, 1, 1>;
+
+	/* Equality operators, which compare the elements of the band.
+	*/
+	template<typename LhsType, typename RhsType, std::size_t N, std::size_t KL, std::size_t KU>
+	constexpr bool operator==(banded_matrix<LhsType, N, KL, KU> const& lhs, banded_matrix<RhsType, N, KL, KU> const& rhs) {
+		for (std::size_t i = 0; i < N; ++i) {
+			for (std::size_t j = i < KL ? 0 : i - KL; j < N && j <= i + KU; ++j) {
+				if (!(lhs(i, j) == rhs(i, j))) { return false; }
+			}
+		}
+		return true;
+	}
+
+	template<typename LhsType, typename RhsType, std::size_t N, std::size_t KL, std::size_t KU>
+	constexpr bool operator!=(banded_matrix<LhsType, N, KL, KU> const& lhs, banded_matrix<RhsType, N, KL, KU> const& rhs) {
+		return !(lhs == rhs);
+	}
+
+	/* Implementation of the `sor::order` metaprogramming function.
+	*/
+	template<typename Type, std::size_t N, std::size_t KL, std::size_t KU>
+	struct order<banded_matrix<Type, N, KL, KU>>
+		: public std::integral_constant<std::size_t, 2> {};
+
+	/* Implementation of the `sor::extent` metaprogramming function.
+	*/
+	template<typename Type, std::size_t N, std::size_t KL, std::size_t KU>
+	struct extent<banded_matrix<Type, N, KL, KU>, 0>
+		: public std::integral_constant<std::size_t, N> {};
+
+	template<typename Type, std::size_t N, std::size_t KL, std::size_t KU>
+	struct extent<banded_matrix<Type, N, KL, KU>, 1>
+		: public std::integral_constant<std::size_t, N> {};
+
+	/* Copies a banded matrix into a dense one.
+	*/
+	template<typename Type, std::size_t N, std::size_t KL, std::size_t KU>
+	constexpr matrix<Type, N, N> materialize(banded_matrix<Type, N, KL, KU> const& banded) {
+		matrix<Type, N, N> result{};
+		for (std::size_t i = 0; i < N; ++i) {
+			for (std::size_t j = i < KL ? 0 : i - KL; j < N && j <= i + KU; ++j) { result(i, j) = banded(i, j); }
+		}
+		return result;
+	}
+
+}
\ No newline at end of file
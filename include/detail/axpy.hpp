@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+
+namespace sor {
+
+	namespace detail {
+
+		/* `out += factor * in` over `k` contiguous elements.
+		*/
+		template<typename Factor, typename InType, typename OutType>
+		void axpy(std::size_t k, Factor factor, InType const* in, OutType* out) {
+			for (std::size_t c = 0; c < k; ++c) { out[c] += factor * in[c]; }
+		}
+
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+namespace sor {
+
+	template<typename Type, std::size_t... Dims>
+	struct tensor;
+
+	namespace detail {
+
+		/* Returns the given extents left padded with ones up to `Order` extents, which
+		 * is how operands of different orders are aligned when broadcasting.
+		*/
+		template<std::size_t Order, std::size_t... Dims>
+		constexpr std::array<std::size_t, Order> aligned_extents() noexcept {
+			std::size_t const dims[] = { Dims..., 0 };
+			std::size_t const padding = Order - sizeof...(Dims);
+			std::array<std::size_t, Order> result{};
+			for (std::size_t i = 0; i < Order; ++i) {
+				result[i] = i < padding ? 1 : dims[i - padding];
+			}
+			return result;
+		}
+
+		/* Broadcasting rules for two tensors with the given extents. As in NumPy the
+		 * extents are aligned to the right, and two aligned extents are compatible if
+		 * they are equal or if either one is 1, in which case the operand is repeated
+		 * along that axis.
+		*/
+		template<typename LhsDims, typename RhsDims>
+		struct broadcast;
+
+		template<std::size_t... LhsDims, std::size_t... RhsDims>
+		struct broadcast<std::index_sequence<LhsDims...>, std::index_sequence<RhsDims...>> {
+
+			static constexpr std::size_t order =
+				sizeof...(LhsDims) > sizeof...(RhsDims) ? sizeof...(LhsDims) : sizeof...(RhsDims);
+
+			static constexpr std::array<std::size_t, order> lhs = aligned_extents<order, LhsDims...>();
+			static constexpr std::array<std::size_t, order> rhs = aligned_extents<order, RhsDims...>();
+
+			static constexpr bool is_compatible() noexcept {
+				for (std::size_t i = 0; i < order; ++i) {
+					if (lhs[i] != rhs[i] && lhs[i] != 1 && rhs[i] != 1) { return false; }
+				}
+				return true;
+			}
+
+			static constexpr std::size_t extent(std::size_t i) noexcept {
+				return lhs[i] == 1 ? rhs[i] : lhs[i];
+			}
+
+			/* Whether the result has the same extents as the left hand side, which is
+			 * required to broadcast in place.
+			*/
+			static constexpr bool preserves_lhs() noexcept {
+				if (sizeof...(LhsDims) != order) { return false; }
+				for (std::size_t i = 0; i < order; ++i) {
+					if (extent(i) != lhs[i]) { return false; }
+				}
+				return true;
+			}
+
+			template<typename Type, typename Indexes = std::make_index_sequence<order>>
+			struct result;
+
+			template<typename Type, std::size_t... Indexes>
+			struct result<Type, std::index_sequence<Indexes...>> {
+				using type = tensor<Type, extent(Indexes)...>;
+			};
+
+		};
+
+		/* Metaprogramming function that returns true if two tensors of the given extents
+		 * are different but can be broadcast against each other.
+		*/
+		template<typename LhsDims, typename RhsDims>
+		struct is_broadcastable
+			: public std::integral_constant<bool,
+				!std::is_same<LhsDims, RhsDims>::value &&
+				broadcast<LhsDims, RhsDims>::is_compatible()
+			> {};
+
+		/* Applies `op` to each pair of broadcast elements of `lhs` and `rhs` and stores the
+		 * result in `out`, which may alias `lhs` if the two have the same extents. No
+		 * expanded copy of either operand is made: a broadcast axis simply has a zero
+		 * stride. The innermost axis is processed by one of four loops, depending on
+		 * which operands are broadcast along it, so that each of them vectorizes.
+		*/
+		template<typename Broadcast, typename LhsType, typename RhsType, typename OutType, typename Operation>
+		void broadcast_transform(LhsType const* lhs, RhsType const* rhs, OutType* out, Operation op) {
+
+			constexpr std::size_t order = Broadcast::order;
+
+			std::size_t lhs_strides[order] = {};
+			std::size_t rhs_strides[order] = {};
+			std::size_t lhs_stride = 1, rhs_stride = 1;
+			for (std::size_t i = order; i-- > 0;) {
+				lhs_strides[i] = Broadcast::lhs[i] == 1 ? 0 : lhs_stride;
+				rhs_strides[i] = Broadcast::rhs[i] == 1 ? 0 : rhs_stride;
+				lhs_stride *= Broadcast::lhs[i];
+				rhs_stride *= Broadcast::rhs[i];
+			}
+
+			std::size_t rows = 1;
+			for (std::size_t i = 0; i + 1 < order; ++i) { rows *= Broadcast::extent(i); }
+			constexpr std::size_t columns = Broadcast::extent(order - 1);
+			std::size_t const lhs_step = lhs_strides[order - 1];
+			std::size_t const rhs_step = rhs_strides[order - 1];
+
+			std::size_t indexes[order] = {};
+			std::size_t lhs_offset = 0, rhs_offset = 0;
+			for (std::size_t row = 0; row < rows; ++row, out += columns) {
+
+				LhsType const* l = lhs + lhs_offset;
+				RhsType const* r = rhs + rhs_offset;
+				if (lhs_step && rhs_step) {
+					for (std::size_t j = 0; j < columns; ++j) { out[j] = op(l[j], r[j]); }
+				} else if (lhs_step) {
+					for (std::size_t j = 0; j < columns; ++j) { out[j] = op(l[j], *r); }
+				} else if (rhs_step) {
+					for (std::size_t j = 0; j < columns; ++j) { out[j] = op(*l, r[j]); }
+				} else {
+					for (std::size_t j = 0; j < columns; ++j) { out[j] = op(*l, *r); }
+				}
+
+				// Advances the indexes of the outer axes, odometer style.
+				for (std::size_t i = order - 1; i-- > 0;) {
+					lhs_offset += lhs_strides[i];
+					rhs_offset += rhs_strides[i];
+					if (++indexes[i] < Broadcast::extent(i)) { break; }
+					lhs_offset -= lhs_strides[i] * indexes[i];
+					rhs_offset -= rhs_strides[i] * indexes[i];
+					indexes[i] = 0;
+				}
+
+			}
+
+		}
+
+	}
+
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#if defined(__has_builtin)
+	#if __has_builtin(__builtin_is_constant_evaluated)
+		#define SOR_HAS_BUILTIN_IS_CONSTANT_EVALUATED
+	#endif
+#endif
+
+namespace sor {
+
+	namespace detail {
+
+		/* Returns true if called during constant evaluation. Without compiler support
+		 * it conservatively returns true, so that callers always take their constexpr
+		 * friendly path.
+		*/
+		constexpr bool is_constant_evaluated() noexcept {
+			#ifdef SOR_HAS_BUILTIN_IS_CONSTANT_EVALUATED
+				return __builtin_is_constant_evaluated();
+			#else
+				return true;
+			#endif
+		}
+
+	}
+
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "constexpr.hpp"
+
+namespace sor {
+
+	namespace detail {
+
+		/* Metaprogramming function that returns true if two elements of the given types
+		 * are equal exactly when their object representations are equal. That's the case
+		 * for integers, enumerations and pointers, but not for floating point numbers
+		 * (`-0.0 == 0.0` and `NaN != NaN`) nor for classes, which may define their own
+		 * equality.
+		*/
+		template<typename LhsType, typename RhsType>
+		struct is_bitwise_comparable
+			: public std::integral_constant<bool,
+				std::is_same<LhsType, RhsType>::value &&
+				std::is_scalar<LhsType>::value &&
+				std::has_unique_object_representations<LhsType>::value
+			> {};
+
+		/* Compares two arithmetic arrays a block at a time. Each block is compared without
+		 * branches, so that it compiles to SIMD compares, and the loop exits early as
+		 * soon as a block contains a mismatch. The comparison itself is still `==`, so
+		 * floating point semantics are preserved.
+		*/
+		template<typename LhsType, typename RhsType>
+		bool equal_blocked(LhsType const* lhs, RhsType const* rhs, std::size_t size) noexcept {
+			constexpr std::size_t block = 16;
+			std::size_t i = 0;
+			for (; i + block <= size; i += block) {
+				bool mismatch = false;
+				for (std::size_t j = 0; j < block; ++j) {
+					mismatch |= !(lhs[i + j] == rhs[i + j]);
+				}
+				if (mismatch) { return false; }
+			}
+			for (; i < size; ++i) {
+				if (!(lhs[i] == rhs[i])) { return false; }
+			}
+			return true;
+		}
+
+		/* Element wise equality of two arrays of the same size.
+		*/
+		template<typename LhsType, typename RhsType>
+		constexpr bool equal(LhsType const* lhs, RhsType const* rhs, std::size_t size) {
+			if (!is_constant_evaluated()) {
+				if constexpr (is_bitwise_comparable<LhsType, RhsType>::value) {
+					return size == 0 || std::memcmp(lhs, rhs, size * sizeof(LhsType)) == 0;
+				} else if constexpr (std::is_arithmetic<LhsType>::value && std::is_arithmetic<RhsType>::value) {
+					return equal_blocked(lhs, rhs, size);
+				}
+			}
+			for (std::size_t i = 0; i < size; ++i) {
+				if (!(lhs[i] == rhs[i])) { return false; }
+			}
+			return true;
+		}
+
+	}
+
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "permute.hpp"
+
+namespace sor {
+
+	namespace detail {
+
+		/* Cache blocking parameters of `gemm`: a `gemm_block_k` deep panel of `b` with
+		 * `gemm_block_n` columns is reused by every row of `a`, and the micro kernel
+		 * updates `gemm_rows` rows of `c` at a time so that each loaded row of `b` is
+		 * used more than once.
+		*/
+		constexpr std::size_t gemm_block_n = 256;
+		constexpr std::size_t gemm_block_k = 128;
+		constexpr std::size_t gemm_rows = 4;
+
+		/* General matrix multiplication, `c += alpha * a * b`, over row major storage
+		 * where `a` is `m` x `k`, `b` is `k` x `n`, `c` is `m` x `n` and `lda`, `ldb` and
+		 * `ldc` are the distances between consecutive rows. The innermost loops run
+		 * along rows of `b` and `c`, so that they vectorize.
+		*/
+		template<typename AType, typename BType, typename CType, typename Scalar>
+		void gemm(
+			std::size_t m, std::size_t n, std::size_t k, Scalar alpha,
+			AType const* a, std::size_t lda,
+			BType const* b, std::size_t ldb,
+			CType* c, std::size_t ldc
+		) {
+			for (std::size_t jj = 0; jj < n; jj += gemm_block_n) {
+				std::size_t const nb = (n - jj < gemm_block_n) ? n - jj : gemm_block_n;
+				for (std::size_t pp = 0; pp < k; pp += gemm_block_k) {
+					std::size_t const kb = (k - pp < gemm_block_k) ? k - pp : gemm_block_k;
+
+					std::size_t i = 0;
+					for (; i + gemm_rows <= m; i += gemm_rows) {
+						CType* c0 = c + (i + 0) * ldc + jj;
+						CType* c1 = c + (i + 1) * ldc + jj;
+						CType* c2 = c + (i + 2) * ldc + jj;
+						CType* c3 = c + (i + 3) * ldc + jj;
+						for (std::size_t p = pp; p < pp + kb; ++p) {
+							CType const a0 = alpha * a[(i + 0) * lda + p];
+							CType const a1 = alpha * a[(i + 1) * lda + p];
+							CType const a2 = alpha * a[(i + 2) * lda + p];
+							CType const a3 = alpha * a[(i + 3) * lda + p];
+							BType const* row = b + p * ldb + jj;
+							for (std::size_t j = 0; j < nb; ++j) {
+								CType const value = row[j];
+								c0[j] += a0 * value;
+								c1[j] += a1 * value;
+								c2[j] += a2 * value;
+								c3[j] += a3 * value;
+							}
+						}
+					}
+					for (; i < m; ++i) {
+						CType* c0 = c + i * ldc + jj;
+						for (std::size_t p = pp; p < pp + kb; ++p) {
+							CType const a0 = alpha * a[i * lda + p];
+							BType const* row = b + p * ldb + jj;
+							for (std::size_t j = 0; j < nb; ++j) {
+								c0[j] += a0 * row[j];
+							}
+						}
+					}
+
+				}
+			}
+		}
+
+		/* `c = a * b` over contiguous row major storage, with the products summed in
+		 * `Accumulator` and rounded to the type of `c` only once at the end. Used for
+		 * element types too narrow to hold the running sums.
+		*/
+		template<typename Accumulator, typename AType, typename BType, typename CType>
+		void gemm_widened(std::size_t m, std::size_t n, std::size_t k, AType const* a, BType const* b, CType* c) {
+			std::vector<Accumulator> sums(m * n, Accumulator());
+			gemm(m, n, k, Accumulator(1), a, k, b, n, sums.data(), n);
+			std::copy(sums.begin(), sums.end(), c);
+		}
+
+		/* Depth of the chunks the dot products of `gemm_int8` are split into. The trip
+		 * count of the loop over a chunk is a constant, so that the compiler turns it into
+		 * widening multiply adds of whole registers of 8 bit integers.
+		*/
+		constexpr std::size_t gemm_int8_depth = 64;
+
+		/* `c = a * b` for 8 bit integers, accumulating in the 32 bit `CType`, where `bt`
+		 * is `b` transposed, `n` x `k`. Each element of `c` is then the dot product of two
+		 * contiguous rows, and they are computed two rows by two columns at a time, so
+		 * that each loaded chunk of `a` and of `bt` is used twice. An odd last row or
+		 * column is computed against itself and stored once.
+		*/
+		template<typename AType, typename BType, typename CType>
+		void gemm_int8_transposed(std::size_t m, std::size_t n, std::size_t k, AType const* a, BType const* bt, CType* c) {
+			for (std::size_t i = 0; i < m; i += 2) {
+				AType const* a0 = a + i * k;
+				AType const* a1 = i + 1 < m ? a0 + k : a0;
+				for (std::size_t j = 0; j < n; j += 2) {
+					BType const* b0 = bt + j * k;
+					BType const* b1 = j + 1 < n ? b0 + k : b0;
+					CType s00 = 0, s01 = 0, s10 = 0, s11 = 0;
+					std::size_t pp = 0;
+					for (; pp + gemm_int8_depth <= k; pp += gemm_int8_depth) {
+						for (std::size_t p = pp; p < pp + gemm_int8_depth; ++p) {
+							s00 += a0[p] * b0[p];
+							s01 += a0[p] * b1[p];
+							s10 += a1[p] * b0[p];
+							s11 += a1[p] * b1[p];
+						}
+					}
+					for (std::size_t p = pp; p < k; ++p) {
+						s00 += a0[p] * b0[p];
+						s01 += a0[p] * b1[p];
+						s10 += a1[p] * b0[p];
+						s11 += a1[p] * b1[p];
+					}
+					c[i * n + j] = s00;
+					if (j + 1 < n) { c[i * n + j + 1] = s01; }
+					if (i + 1 < m) {
+						c[(i + 1) * n + j] = s10;
+						if (j + 1 < n) { c[(i + 1) * n + j + 1] = s11; }
+					}
+				}
+			}
+		}
+
+		/* `c = a * b` for 8 bit integers over contiguous row major storage, accumulating
+		 * in the 32 bit `CType`.
+		*/
+		template<typename AType, typename BType, typename CType>
+		void gemm_int8(std::size_t m, std::size_t n, std::size_t k, AType const* a, BType const* b, CType* c) {
+			std::vector<BType> bt(k * n);
+			transpose(b, k, n, bt.data());
+			gemm_int8_transposed(m, n, k, a, bt.data(), c);
+		}
+
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <functional>
+#include <type_traits>
+
+namespace sor {
+
+	namespace detail {
+
+		/* Non cryptographic 64 bit hash of a byte sequence, modelled after xxHash3.
+		 * The input is consumed in 64 byte stripes by eight independent accumulators
+		 * that only use 32x32->64 multiplications, so that the main loop maps onto
+		 * SIMD registers. The accumulators are scrambled every 16 stripes and merged
+		 * with 128 bit multiplications at the end.
+		 * Note: The hash values are not compatible with the reference xxHash3
+		 * implementation and may differ between platforms with different endianness.
+		*/
+		struct stripe_hasher {
+
+			static constexpr std::size_t lanes = 8;
+			static constexpr std::size_t stripe_size = lanes * sizeof(std::uint64_t);
+			static constexpr std::size_t stripes_per_block = 16;
+			static constexpr std::size_t block_size = stripe_size * stripes_per_block;
+
+			static constexpr std::uint32_t prime32_1 = 0x9E3779B1u;
+			static constexpr std::uint64_t prime64_1 = 0x9E3779B185EBCA87ull;
+			static constexpr std::uint64_t prime64_2 = 0xC2B2AE3D27D4EB4Full;
+			static constexpr std::uint64_t prime64_3 = 0x165667B19E3779F9ull;
+			static constexpr std::uint64_t prime64_4 = 0x85EBCA77C2B2AE63ull;
+			static constexpr std::uint64_t prime64_5 = 0x27D4EB2F165667C5ull;
+
+			std::uint64_t accumulators[lanes] = {
+				prime32_1, prime64_1, prime64_2, prime64_3,
+				prime64_4, prime32_1, prime64_5, prime32_1
+			};
+			std::size_t stripes = 0;
+			std::size_t length = 0;
+
+			static constexpr std::uint64_t secret[lanes + stripes_per_block] = {
+				0xBE4BA423396CFEB8ull, 0x1CAD21F72C81017Cull, 0xDB979083E96DD4DEull, 0x1F67B3B7A4A44072ull,
+				0x78E5C0CC4EE679CBull, 0x2172FFCC7DD05A82ull, 0x8E2443F7744608B8ull, 0x4C263A81E69035E0ull,
+				0xCB00C391BB52283Cull, 0xA32E531B8B65D088ull, 0x4EF90DA297486471ull, 0xD8ACDEA946EF1938ull,
+				0x3F349CE33F76FAA8ull, 0x1D4F0BC7C7BBDCF9ull, 0x3159B4CD4BE0518Aull, 0x647378D9C97E9FC8ull,
+				0xC3EBD33483ACC5EAull, 0xEB6313FAFFA081C5ull, 0x49DAF0B751DD0D17ull, 0x9E68D429265516D3ull,
+				0xFCA1477D58BE162Bull, 0xCE31D07AD1B8F88Full, 0x280416958F3ACB45ull, 0x7E404BBBCAFBD7AFull
+			};
+
+			static std::uint64_t load(unsigned char const* bytes) noexcept {
+				std::uint64_t value;
+				std::memcpy(&value, bytes, sizeof(value));
+				return value;
+			}
+
+			static std::uint64_t multiply_fold(std::uint64_t lhs, std::uint64_t rhs) noexcept {
+				#ifdef __SIZEOF_INT128__
+					auto product = static_cast<unsigned __int128>(lhs) * rhs;
+					return static_cast<std::uint64_t>(product) ^ static_cast<std::uint64_t>(product >> 64);
+				#else
+					std::uint64_t lo_lo = (lhs & 0xFFFFFFFF) * (rhs & 0xFFFFFFFF);
+					std::uint64_t hi_lo = (lhs >> 32) * (rhs & 0xFFFFFFFF);
+					std::uint64_t lo_hi = (lhs & 0xFFFFFFFF) * (rhs >> 32);
+					std::uint64_t hi_hi = (lhs >> 32) * (rhs >> 32);
+					std::uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + lo_hi;
+					std::uint64_t upper = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+					std::uint64_t lower = (cross << 32) | (lo_lo & 0xFFFFFFFF);
+					return lower ^ upper;
+				#endif
+			}
+
+			static std::uint64_t avalanche(std::uint64_t hash) noexcept {
+				hash ^= hash >> 37;
+				hash *= 0x165667919E3779F9ull;
+				hash ^= hash >> 32;
+				return hash;
+			}
+
+			/* Accumulates `count` stripes, with `count` not crossing the end of a block.
+			*/
+			void accumulate_stripes(unsigned char const* bytes, std::size_t count) noexcept {
+				std::uint64_t local[lanes];
+				std::memcpy(local, accumulators, sizeof(local));
+				std::uint64_t const* keys = secret + stripes % stripes_per_block;
+				for (std::size_t s = 0; s < count; ++s, bytes += stripe_size) {
+					for (std::size_t i = 0; i < lanes; ++i) {
+						auto value = load(bytes + i * sizeof(std::uint64_t));
+						auto keyed = value ^ keys[s + i];
+						local[i ^ 1] += value;
+						local[i] += (keyed & 0xFFFFFFFF) * (keyed >> 32);
+					}
+				}
+				stripes += count;
+				if (stripes % stripes_per_block == 0) {
+					for (std::size_t i = 0; i < lanes; ++i) {
+						local[i] ^= local[i] >> 47;
+						local[i] ^= secret[i + stripes_per_block];
+						local[i] *= prime32_1;
+					}
+				}
+				std::memcpy(accumulators, local, sizeof(local));
+			}
+
+			/* Consumes a sequence of bytes. All but the last call must pass a multiple
+			 * of `stripe_size` bytes.
+			*/
+			void update(void const* data, std::size_t size) noexcept {
+				auto bytes = static_cast<unsigned char const*>(data);
+				length += size;
+				while (size >= stripe_size) {
+					auto block_left = stripes_per_block - stripes % stripes_per_block;
+					auto count = size / stripe_size < block_left ? size / stripe_size : block_left;
+					accumulate_stripes(bytes, count);
+					bytes += count * stripe_size;
+					size -= count * stripe_size;
+				}
+				if (size > 0) {
+					unsigned char last[stripe_size] = {};
+					std::memcpy(last, bytes, size);
+					accumulate_stripes(last, 1);
+				}
+			}
+
+			std::uint64_t digest() const noexcept {
+				std::uint64_t hash = length * prime64_1;
+				for (std::size_t i = 0; i < lanes; i += 2) {
+					hash += multiply_fold(
+						accumulators[i] ^ secret[i],
+						accumulators[i + 1] ^ secret[i + 1]
+					);
+				}
+				return avalanche(hash);
+			}
+
+		};
+
+		/* Hashes a sequence of elements by first mapping each of them onto a word and
+		 * then hashing the words, a buffer at a time.
+		*/
+		template<typename Word, typename Type, typename Function>
+		std::uint64_t hash_mapped(Type const* data, std::size_t size, Function map) noexcept {
+			constexpr std::size_t buffer_size = stripe_hasher::block_size / sizeof(Word);
+			Word buffer[buffer_size];
+			stripe_hasher hasher;
+			while (size > 0) {
+				auto count = size < buffer_size ? size : buffer_size;
+				for (std::size_t i = 0; i < count; ++i) {
+					buffer[i] = map(data[i]);
+				}
+				hasher.update(buffer, count * sizeof(Word));
+				data += count;
+				size -= count;
+			}
+			return hasher.digest();
+		}
+
+		/* Hash of a contiguous sequence of elements, consistent with `operator==`:
+		 *  - integers, enumerations and pointers are hashed through their object
+		 *    representation directly;
+		 *  - `float` and `double` are hashed through their bit pattern after mapping
+		 *    `-0.0` onto `0.0`, so that the two zeros hash equally, and every NaN onto
+		 *    the same quiet NaN, so that NaNs hash consistently even though they never
+		 *    compare equal;
+		 *  - any other type is hashed through the `std::hash` value of each element.
+		*/
+		template<typename Type>
+		std::uint64_t hash(Type const* data, std::size_t size) noexcept {
+			if constexpr (
+				std::is_scalar<Type>::value &&
+				std::has_unique_object_representations<Type>::value
+			) {
+				stripe_hasher hasher;
+				hasher.update(data, size * sizeof(Type));
+				return hasher.digest();
+			} else if constexpr (
+				std::is_floating_point<Type>::value &&
+				std::numeric_limits<Type>::is_iec559 &&
+				(sizeof(Type) == sizeof(std::uint32_t) || sizeof(Type) == sizeof(std::uint64_t))
+			) {
+				using word_type = typename std::conditional<
+					sizeof(Type) == sizeof(std::uint32_t),
+					std::uint32_t,
+					std::uint64_t
+				>::type;
+				return hash_mapped<word_type>(data, size, [](Type value) {
+					if (value == Type(0)) { value = Type(0); }
+					if (value != value) { value = std::numeric_limits<Type>::quiet_NaN(); }
+					word_type word;
+					std::memcpy(&word, &value, sizeof(word));
+					return word;
+				});
+			} else {
+				return hash_mapped<std::size_t>(data, size, [](Type const& value) {
+					return std::hash<Type>()(value);
+				});
+			}
+		}
+
+	}
+
+}
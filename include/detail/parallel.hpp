@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace sor {
+
+	namespace detail {
+
+		/* Number of threads used by parallel algorithms: the hardware concurrency, or 1
+		 * if the library is built with `SOR_NO_THREADS` defined.
+		*/
+		inline std::size_t thread_count() noexcept {
+		#ifdef SOR_NO_THREADS
+			return 1;
+		#else
+			unsigned const count = std::thread::hardware_concurrency();
+			return count == 0 ? 1 : count;
+		#endif
+		}
+
+		/* Calls `function(begin, end)` on consecutive chunks of `[0, size)`, running them
+		 * on up to `thread_count()` threads. Chunks are never smaller than `grain`
+		 * iterations, so small loops run entirely on the calling thread, which also
+		 * takes the first chunk. `function` must not throw.
+		*/
+		template<typename Function>
+		void parallel_for(std::size_t size, std::size_t grain, Function&& function) {
+			std::size_t chunks = thread_count();
+			std::size_t const most = grain == 0 ? size : size / grain;
+			if (most < chunks) { chunks = most; }
+			if (chunks <= 1) {
+				if (size > 0) { function(std::size_t(0), size); }
+				return;
+			}
+
+			std::vector<std::thread> threads;
+			threads.reserve(chunks - 1);
+			for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+				std::size_t const begin = size * chunk / chunks;
+				std::size_t const end = size * (chunk + 1) / chunks;
+				threads.emplace_back([&function, begin, end] { function(begin, end); });
+			}
+			function(std::size_t(0), size / chunks);
+			for (auto& thread : threads) { thread.join(); }
+		}
+
+	}
+
+}
\ No newline at end of file
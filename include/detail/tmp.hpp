@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <utility>
 #include <type_traits>
 
 namespace sor {
@@ -7,18 +9,105 @@ namespace sor {
 	namespace detail {
 
 		/*	Metaprogramming function that calculates the multiplication of all integers
-		 * 	passed to it.
+		 * 	passed to it. It's implemented as a fold expression so that it takes a single
+		 * 	instantiation regardless of the number of integers.
 		 * 	Example:
 		 * 		std::cout << multiply<2, 3, 4>::value;
 		 *		// = 2 * 3 * 4 = 24;
 		*/
-		template<std::size_t N, std::size_t... Ms>
-		struct multiply 
-			: public std::integral_constant<std::size_t, N * multiply<Ms...>::value> {};
+		template<std::size_t... Ns>
+		struct multiply
+			: public std::integral_constant<std::size_t, (Ns * ... * std::size_t(1))> {};
 
-		template<std::size_t N>
-		struct multiply<N> 
-			: public std::integral_constant<std::size_t, N> {};
+		/*	Returns the nth integer of the given pack, without recursing through the pack.
+		 * 	Example:
+		 * 		std::cout << nth<1, 2, 3, 4>();
+		 *		// = 3
+		*/
+		template<std::size_t Index, std::size_t... Ns>
+		constexpr std::size_t nth() noexcept {
+			static_assert(Index < sizeof...(Ns), "index out of range");
+			std::size_t const values[] = { Ns... };
+			return values[Index];
+		}
+
+		/*	Returns the multiplication of the integers of the given pack in the range
+		 * 	[Begin, End).
+		 * 	Example:
+		 * 		std::cout << product<1, 3, 2, 3, 4, 5>();
+		 *		// = 3 * 4 = 12
+		*/
+		template<std::size_t Begin, std::size_t End, std::size_t... Ns>
+		constexpr std::size_t product() noexcept {
+			static_assert(Begin <= End && End <= sizeof...(Ns), "range out of bounds");
+			std::size_t const values[] = { Ns..., 0 };
+			std::size_t result = 1;
+			for (std::size_t i = Begin; i < End; ++i) {
+				result *= values[i];
+			}
+			return result;
+		}
+
+		/*	Metaprogramming function that removes the integer at the given position from
+		 * 	an `std::index_sequence`.
+		 * 	Example:
+		 * 		remove_index<1, std::index_sequence<2, 3, 4>>::type
+		 *		// = std::index_sequence<2, 4>
+		*/
+		template<std::size_t Index, typename Sequence,
+			typename Indexes = std::make_index_sequence<Sequence::size() - 1>>
+		struct remove_index;
+
+		template<std::size_t Index, std::size_t... Ns, std::size_t... Indexes>
+		struct remove_index<Index, std::index_sequence<Ns...>, std::index_sequence<Indexes...>> {
+			static_assert(Index < sizeof...(Ns), "index out of range");
+			using type = std::index_sequence<nth<(Indexes < Index ? Indexes : Indexes + 1), Ns...>()...>;
+		};
+
+		/*	Metaprogramming function that concatenates two `std::index_sequence`s.
+		*/
+		template<typename Lhs, typename Rhs>
+		struct concatenate;
+
+		template<std::size_t... Lhs, std::size_t... Rhs>
+		struct concatenate<std::index_sequence<Lhs...>, std::index_sequence<Rhs...>> {
+			using type = std::index_sequence<Lhs..., Rhs...>;
+		};
+
+		/*	Metaprogramming functions that return the permutation of `N` axes that moves
+		 * 	the given axis to the back or to the front, leaving the others in order.
+		 * 	Example:
+		 * 		move_axis_to_back<1, 4>::type
+		 *		// = std::index_sequence<0, 2, 3, 1>
+		*/
+		template<std::size_t Axis, std::size_t N>
+		struct move_axis_to_back
+			: public concatenate<
+				typename remove_index<Axis, std::make_index_sequence<N>>::type,
+				std::index_sequence<Axis>
+			> {};
+
+		template<std::size_t Axis, std::size_t N>
+		struct move_axis_to_front
+			: public concatenate<
+				std::index_sequence<Axis>,
+				typename remove_index<Axis, std::make_index_sequence<N>>::type
+			> {};
+
+		/*	Returns true if the given integers are a permutation of `0, 1, ..., N - 1`.
+		*/
+		template<std::size_t... Ns>
+		constexpr bool is_permutation() noexcept {
+			std::size_t const values[] = { Ns..., 0 };
+			for (std::size_t i = 0; i < sizeof...(Ns); ++i) {
+				std::size_t count = 0;
+				for (std::size_t j = 0; j < sizeof...(Ns); ++j) {
+					count += values[j] == i;
+				}
+				if (count != 1) { return false; }
+			}
+			return true;
+		}
 
 	}
 
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+
+namespace sor {
+
+	namespace detail {
+
+		/* Triangular solves over row major storage. Each of them overwrites the `n` x `k`
+		 * right hand side `x` with the solution of `T * X = X`, where `T` is the `n` x `n`
+		 * lower or upper triangle stored in `t`; `ldt` and `ldx` are the distances
+		 * between consecutive rows. If `UnitDiagonal` is true the diagonal of `T` is
+		 * assumed to be all ones and is never read. The innermost loops run along the
+		 * rows of `x`, so that they vectorize.
+		*/
+		template<bool UnitDiagonal, typename TType, typename XType>
+		void solve_lower(
+			std::size_t n, std::size_t k,
+			TType const* t, std::size_t ldt,
+			XType* x, std::size_t ldx
+		) {
+			for (std::size_t i = 0; i < n; ++i) {
+				XType* row = x + i * ldx;
+				for (std::size_t j = 0; j < i; ++j) {
+					XType const factor = t[i * ldt + j];
+					XType const* other = x + j * ldx;
+					for (std::size_t c = 0; c < k; ++c) { row[c] -= factor * other[c]; }
+				}
+				if constexpr (!UnitDiagonal) {
+					XType const diagonal = t[i * ldt + i];
+					for (std::size_t c = 0; c < k; ++c) { row[c] /= diagonal; }
+				}
+			}
+		}
+
+		template<bool UnitDiagonal, typename TType, typename XType>
+		void solve_upper(
+			std::size_t n, std::size_t k,
+			TType const* t, std::size_t ldt,
+			XType* x, std::size_t ldx
+		) {
+			for (std::size_t i = n; i-- > 0;) {
+				XType* row = x + i * ldx;
+				for (std::size_t j = i + 1; j < n; ++j) {
+					XType const factor = t[i * ldt + j];
+					XType const* other = x + j * ldx;
+					for (std::size_t c = 0; c < k; ++c) { row[c] -= factor * other[c]; }
+				}
+				if constexpr (!UnitDiagonal) {
+					XType const diagonal = t[i * ldt + i];
+					for (std::size_t c = 0; c < k; ++c) { row[c] /= diagonal; }
+				}
+			}
+		}
+
+		/* Solves `T^T * X = X`, where `T` is the `n` x `n` lower triangle stored in `t`.
+		 * The transpose is never formed: every solved row of `x` is subtracted from the
+		 * rows above it, reading `t` a row at a time.
+		*/
+		template<bool UnitDiagonal, typename TType, typename XType>
+		void solve_lower_transposed(
+			std::size_t n, std::size_t k,
+			TType const* t, std::size_t ldt,
+			XType* x, std::size_t ldx
+		) {
+			for (std::size_t j = n; j-- > 0;) {
+				XType* solved = x + j * ldx;
+				if constexpr (!UnitDiagonal) {
+					XType const diagonal = t[j * ldt + j];
+					for (std::size_t c = 0; c < k; ++c) { solved[c] /= diagonal; }
+				}
+				for (std::size_t i = 0; i < j; ++i) {
+					XType const factor = t[j * ldt + i];
+					XType* row = x + i * ldx;
+					for (std::size_t c = 0; c < k; ++c) { row[c] -= factor * solved[c]; }
+				}
+			}
+		}
+
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,312 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+#if defined(__F16C__) || (defined(__AVX512BF16__) && defined(__AVX512VL__))
+	#include <immintrin.h>
+#endif
+
+#if defined(__F16C__)
+	#define SOR_HAS_F16C
+#endif
+
+#if defined(__AVX512BF16__) && defined(__AVX512VL__)
+	#define SOR_HAS_AVX512_BF16
+#endif
+
+#include "type_traits.hpp"
+
+namespace sor {
+
+	namespace detail {
+
+		inline std::uint32_t float_bits(float value) noexcept {
+			std::uint32_t bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+			return bits;
+		}
+
+		inline float bits_float(std::uint32_t bits) noexcept {
+			float value;
+			std::memcpy(&value, &bits, sizeof(value));
+			return value;
+		}
+
+		/* IEEE 754 binary16 encoding of `value`, rounded to nearest even. With F16C the
+		 * hardware conversion is used.
+		*/
+		inline std::uint16_t float_to_half(float value) noexcept {
+			#ifdef SOR_HAS_F16C
+				return static_cast<std::uint16_t>(_cvtss_sh(value, 0));
+			#else
+				std::uint32_t const bits = float_bits(value);
+				std::uint32_t const sign = (bits >> 16) & 0x8000u;
+				std::uint32_t const magnitude = bits & 0x7fffffffu;
+				if (magnitude >= 0x7f800000u) {
+					std::uint32_t const payload = magnitude > 0x7f800000u ? 0x200u | ((magnitude >> 13) & 0x3ffu) : 0u;
+					return static_cast<std::uint16_t>(sign | 0x7c00u | payload);
+				}
+				if (magnitude >= 0x477ff000u) { return static_cast<std::uint16_t>(sign | 0x7c00u); }
+				if (magnitude < 0x38800000u) {
+					// Adding one half puts the unit of the subnormal halves, 2^-24, at the
+					// last bit of the float, so that the addition rounds the mantissa.
+					float const shifted = bits_float(magnitude) + 0.5f;
+					return static_cast<std::uint16_t>(sign | (float_bits(shifted) - 0x3f000000u));
+				}
+				std::uint32_t const rounded = magnitude + 0xfffu + ((magnitude >> 13) & 1u);
+				return static_cast<std::uint16_t>(sign | ((rounded - 0x38000000u) >> 13));
+			#endif
+		}
+
+		/* Value of the IEEE 754 binary16 encoding `bits`, which is exact.
+		*/
+		inline float half_to_float(std::uint16_t bits) noexcept {
+			#ifdef SOR_HAS_F16C
+				return _cvtsh_ss(bits);
+			#else
+				std::uint32_t const sign = std::uint32_t(bits & 0x8000u) << 16;
+				std::uint32_t const exponent = (bits >> 10) & 0x1fu;
+				std::uint32_t const mantissa = bits & 0x3ffu;
+				if (exponent == 0x1fu) { return bits_float(sign | 0x7f800000u | (mantissa << 13)); }
+				if (exponent == 0) {
+					float const magnitude = float(mantissa) * 5.9604644775390625e-8f;
+					return bits_float(sign | float_bits(magnitude));
+				}
+				return bits_float(sign | ((exponent + 112) << 23) | (mantissa << 13));
+			#endif
+		}
+
+		/* bfloat16 encoding of `value`, the upper half of its bits rounded to nearest
+		 * even; NaNs stay quiet NaNs. With AVX-512 BF16 the hardware conversion is used.
+		*/
+		inline std::uint16_t float_to_brain(float value) noexcept {
+			#ifdef SOR_HAS_AVX512_BF16
+				__m128i const converted = (__m128i)_mm_cvtneps_pbh(_mm_set_ss(value));
+				return static_cast<std::uint16_t>(_mm_cvtsi128_si32(converted));
+			#else
+				std::uint32_t const bits = float_bits(value);
+				if ((bits & 0x7fffffffu) > 0x7f800000u) { return static_cast<std::uint16_t>((bits >> 16) | 0x40u); }
+				return static_cast<std::uint16_t>((bits + 0x7fffu + ((bits >> 16) & 1u)) >> 16);
+			#endif
+		}
+
+		/* Value of the bfloat16 encoding `bits`, which is exact.
+		*/
+		inline float brain_to_float(std::uint16_t bits) noexcept {
+			return bits_float(std::uint32_t(bits) << 16);
+		}
+
+		/* Storage and conversions shared by the 16 bit floating point types: `Encode`
+		 * and `Decode` convert between `float` and the bits.
+		*/
+		template<typename Derived, std::uint16_t (*Encode)(float), float (*Decode)(std::uint16_t)>
+		struct narrow_float {
+
+			/* Regular copy and move constructors work as you would expect; the default one
+			 * gives positive zero.
+			*/
+			constexpr narrow_float() noexcept
+				: value_bits(0) {}
+
+			/* Rounds a `float` to the nearest representable value. The conversion is
+			 * implicit in both directions, so that narrow floats mix with the built in
+			 * types in expressions, which are evaluated in `float` or wider.
+			*/
+			narrow_float(float value) noexcept
+				: value_bits(Encode(value)) {}
+
+			operator float() const noexcept { return Decode(value_bits); }
+
+			/* The encoding of the value.
+			*/
+			constexpr std::uint16_t bits() const noexcept { return value_bits; }
+
+			static constexpr Derived from_bits(std::uint16_t bits) noexcept {
+				Derived result;
+				result.value_bits = bits;
+				return result;
+			}
+
+			/* Compound assignment, computed in `float` and rounded once.
+			*/
+			Derived& operator+=(float rhs) noexcept { return assign(float(*this) + rhs); }
+			Derived& operator-=(float rhs) noexcept { return assign(float(*this) - rhs); }
+			Derived& operator*=(float rhs) noexcept { return assign(float(*this) * rhs); }
+			Derived& operator/=(float rhs) noexcept { return assign(float(*this) / rhs); }
+
+		private:
+
+			std::uint16_t value_bits;
+
+			Derived& assign(float value) noexcept {
+				value_bits = Encode(value);
+				return static_cast<Derived&>(*this);
+			}
+
+		};
+
+	}
+
+	/* IEEE 754 half precision floating point number: 5 exponent bits and 10 mantissa
+	 * bits, for values up to 65504 with about three decimal digits. Arithmetic is
+	 * carried out in `float`, and the result rounded back only when it is stored.
+	 * Example:
+	 * 		sor::vector<sor::float16, 4> weights({ 0.5f, 0.25f, -1.0f, 2.0f });
+	 * 		float sum = sor::dot_product(weights, weights); // accumulated in float
+	*/
+	struct float16 : detail::narrow_float<float16, detail::float_to_half, detail::half_to_float> {
+		using narrow_float::narrow_float;
+	};
+
+	/* Brain floating point number: the upper half of a `float`, with its 8 exponent
+	 * bits and 7 mantissa bits, so that it has the range of a `float` with about two
+	 * decimal digits and converts to it by a shift.
+	*/
+	struct bfloat16 : detail::narrow_float<bfloat16, detail::float_to_brain, detail::brain_to_float> {
+		using narrow_float::narrow_float;
+	};
+
+	/* Sums and products of 16 bit floats are accumulated in `float`.
+	*/
+	template<>
+	struct accumulation_type<float16> {
+		using type = float;
+	};
+
+	template<>
+	struct accumulation_type<bfloat16> {
+		using type = float;
+	};
+
+}
+
+namespace std {
+
+	/* Widening rules: 16 bit floats keep their type among themselves, and widen to
+	 * `float` when mixed with each other or with integers and to the other floating
+	 * point type otherwise.
+	*/
+	template<typename Type>
+	struct common_type<sor::float16, Type> : common_type<float, Type> {};
+
+	template<typename Type>
+	struct common_type<Type, sor::float16> : common_type<Type, float> {};
+
+	template<typename Type>
+	struct common_type<sor::bfloat16, Type> : common_type<float, Type> {};
+
+	template<typename Type>
+	struct common_type<Type, sor::bfloat16> : common_type<Type, float> {};
+
+	template<>
+	struct common_type<sor::float16, sor::float16> {
+		using type = sor::float16;
+	};
+
+	template<>
+	struct common_type<sor::bfloat16, sor::bfloat16> {
+		using type = sor::bfloat16;
+	};
+
+	template<>
+	struct common_type<sor::float16, sor::bfloat16> {
+		using type = float;
+	};
+
+	template<>
+	struct common_type<sor::bfloat16, sor::float16> {
+		using type = float;
+	};
+
+	/* Hashes agree with equality, as for `float`.
+	*/
+	template<>
+	struct hash<sor::float16> {
+		std::size_t operator()(sor::float16 value) const noexcept { return hash<float>()(float(value)); }
+	};
+
+	template<>
+	struct hash<sor::bfloat16> {
+		std::size_t operator()(sor::bfloat16 value) const noexcept { return hash<float>()(float(value)); }
+	};
+
+	template<>
+	class numeric_limits<sor::float16> {
+	public:
+		static constexpr bool is_specialized = true;
+		static constexpr bool is_signed = true;
+		static constexpr bool is_integer = false;
+		static constexpr bool is_exact = false;
+		static constexpr bool has_infinity = true;
+		static constexpr bool has_quiet_NaN = true;
+		static constexpr bool is_iec559 = true;
+		static constexpr int digits = 11;
+		static constexpr int digits10 = 3;
+		static constexpr int max_digits10 = 5;
+		static constexpr int radix = 2;
+		static constexpr int min_exponent = -13;
+		static constexpr int min_exponent10 = -4;
+		static constexpr int max_exponent = 16;
+		static constexpr int max_exponent10 = 4;
+		static constexpr bool has_signaling_NaN = true;
+		static constexpr float_denorm_style has_denorm = denorm_present;
+		static constexpr bool has_denorm_loss = false;
+		static constexpr bool is_bounded = true;
+		static constexpr bool is_modulo = false;
+		static constexpr bool traps = false;
+		static constexpr bool tinyness_before = false;
+		static constexpr float_round_style round_style = round_to_nearest;
+		static constexpr sor::float16 min() noexcept { return sor::float16::from_bits(0x0400); }
+		static constexpr sor::float16 max() noexcept { return sor::float16::from_bits(0x7bff); }
+		static constexpr sor::float16 lowest() noexcept { return sor::float16::from_bits(0xfbff); }
+		static constexpr sor::float16 epsilon() noexcept { return sor::float16::from_bits(0x1400); }
+		static constexpr sor::float16 round_error() noexcept { return sor::float16::from_bits(0x3800); }
+		static constexpr sor::float16 infinity() noexcept { return sor::float16::from_bits(0x7c00); }
+		static constexpr sor::float16 quiet_NaN() noexcept { return sor::float16::from_bits(0x7e00); }
+		static constexpr sor::float16 signaling_NaN() noexcept { return sor::float16::from_bits(0x7d00); }
+		static constexpr sor::float16 denorm_min() noexcept { return sor::float16::from_bits(0x0001); }
+	};
+
+	template<>
+	class numeric_limits<sor::bfloat16> {
+	public:
+		static constexpr bool is_specialized = true;
+		static constexpr bool is_signed = true;
+		static constexpr bool is_integer = false;
+		static constexpr bool is_exact = false;
+		static constexpr bool has_infinity = true;
+		static constexpr bool has_quiet_NaN = true;
+		static constexpr bool is_iec559 = false;
+		static constexpr int digits = 8;
+		static constexpr int digits10 = 2;
+		static constexpr int max_digits10 = 4;
+		static constexpr int radix = 2;
+		static constexpr int min_exponent = -125;
+		static constexpr int min_exponent10 = -37;
+		static constexpr int max_exponent = 128;
+		static constexpr int max_exponent10 = 38;
+		static constexpr bool has_signaling_NaN = true;
+		static constexpr float_denorm_style has_denorm = denorm_present;
+		static constexpr bool has_denorm_loss = false;
+		static constexpr bool is_bounded = true;
+		static constexpr bool is_modulo = false;
+		static constexpr bool traps = false;
+		static constexpr bool tinyness_before = false;
+		static constexpr float_round_style round_style = round_to_nearest;
+		static constexpr sor::bfloat16 min() noexcept { return sor::bfloat16::from_bits(0x0080); }
+		static constexpr sor::bfloat16 max() noexcept { return sor::bfloat16::from_bits(0x7f7f); }
+		static constexpr sor::bfloat16 lowest() noexcept { return sor::bfloat16::from_bits(0xff7f); }
+		static constexpr sor::bfloat16 epsilon() noexcept { return sor::bfloat16::from_bits(0x3c00); }
+		static constexpr sor::bfloat16 round_error() noexcept { return sor::bfloat16::from_bits(0x3f00); }
+		static constexpr sor::bfloat16 infinity() noexcept { return sor::bfloat16::from_bits(0x7f80); }
+		static constexpr sor::bfloat16 quiet_NaN() noexcept { return sor::bfloat16::from_bits(0x7fc0); }
+		static constexpr sor::bfloat16 signaling_NaN() noexcept { return sor::bfloat16::from_bits(0x7fa0); }
+		static constexpr sor::bfloat16 denorm_min() noexcept { return sor::bfloat16::from_bits(0x0001); }
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,227 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+
+#include "type_traits.hpp"
+#include "matrix.hpp"
+
+namespace sor {
+
+	/* Implementation details.
+	*/
+	namespace detail {
+
+		/* Layouts of the packed matrices: how many elements an `n` x `n` matrix stores,
+		 * whether element `(i, j)` is stored (the others are known to be zero) and where.
+		 * Triangles are stored a row at a time, so that each row is contiguous.
+		*/
+		struct lower_packing {
+			static constexpr std::size_t size(std::size_t n) noexcept { return n * (n + 1) / 2; }
+			static constexpr bool stored(std::size_t i, std::size_t j) noexcept { return j <= i; }
+			static constexpr std::size_t index(std::size_t, std::size_t i, std::size_t j) noexcept {
+				return i * (i + 1) / 2 + j;
+			}
+		};
+
+		struct upper_packing {
+			static constexpr std::size_t size(std::size_t n) noexcept { return n * (n + 1) / 2; }
+			static constexpr bool stored(std::size_t i, std::size_t j) noexcept { return j >= i; }
+			static constexpr std::size_t index(std::size_t n, std::size_t i, std::size_t j) noexcept {
+				return i * (2 * n - i + 1) / 2 + (j - i);
+			}
+		};
+
+		/* The upper triangle of a symmetric matrix aliases the lower one.
+		*/
+		struct symmetric_packing {
+			static constexpr std::size_t size(std::size_t n) noexcept { return n * (n + 1) / 2; }
+			static constexpr bool stored(std::size_t, std::size_t) noexcept { return true; }
+			static constexpr std::size_t index(std::size_t, std::size_t i, std::size_t j) noexcept {
+				return j <= i ? i * (i + 1) / 2 + j : j * (j + 1) / 2 + i;
+			}
+		};
+
+		struct diagonal_packing {
+			static constexpr std::size_t size(std::size_t n) noexcept { return n; }
+			static constexpr bool stored(std::size_t i, std::size_t j) noexcept { return i == j; }
+			static constexpr std::size_t index(std::size_t, std::size_t i, std::size_t) noexcept { return i; }
+		};
+
+	}
+
+	/* Square matrix that only stores the elements that its structure doesn't force to
+	 * be zero (or, for symmetric matrices, equal to another element), as described by
+	 * `Packing`. Elements are listed in the packed order, a row at a time.
+	 * Example:
+	 * 		sor::lower_triangular<double, 3> l({
+	 * 			1,
+	 * 			2, 3,
+	 * 			4, 5, 6
+	 * 		});
+	 * 		l(2, 1); // 5
+	 * 		l(1, 2); // 0, which can't be assigned to
+	*/
+	template<typename Type, std::size_t N, typename Packing>
+	struct packed_matrix {
+
+	private:
+
+		using container_type = std::array<Type, Packing::size(N)>;
+
+		container_type array;
+
+	public:
+
+		/* Type definitions
+		*/
+		using value_type = typename container_type::value_type;
+		using packing_type = Packing;
+
+		using reference = typename container_type::reference;
+		using const_reference = typename container_type::const_reference;
+
+		using pointer = typename container_type::pointer;
+		using const_pointer = typename container_type::const_pointer;
+
+		using iterator = typename container_type::iterator;
+		using const_iterator = typename container_type::const_iterator;
+
+		using size_type = std::size_t;
+
+		/* Regular default, copy and move constructors work as you would expect.
+		*/
+		packed_matrix() = default;
+		packed_matrix(packed_matrix const&) = default;
+		packed_matrix(packed_matrix&&) = default;
+
+		packed_matrix& operator=(packed_matrix const&) = default;
+		packed_matrix& operator=(packed_matrix&&) = default;
+
+		/* Initializes the stored elements in the packed order. Elements past the end are
+		 * ignored and missing ones are value initialized.
+		*/
+		template<typename OtherType>
+		constexpr explicit packed_matrix(std::initializer_list<OtherType> const& list)
+				noexcept(std::is_nothrow_assignable<Type, OtherType>::value)
+			: array() {
+			auto it = list.begin();
+			for (std::size_t i = 0; i < size() && it != list.end(); ++i, ++it) {
+				array[i] = *it;
+			}
+		}
+
+		/* Copies the stored elements of a dense matrix; the others are ignored.
+		*/
+		template<typename OtherType>
+		constexpr explicit packed_matrix(matrix<OtherType, N, N> const& dense)
+				noexcept(std::is_nothrow_assignable<Type, OtherType>::value)
+			: array() {
+			for (std::size_t i = 0; i < N; ++i) {
+				for (std::size_t j = 0; j < N; ++j) {
+					if (Packing::stored(i, j)) { array[Packing::index(N, i, j)] = dense(i, j); }
+				}
+			}
+		}
+
+		/* Iterators over the stored elements.
+		*/
+		constexpr iterator begin() noexcept { return array.begin(); }
+		constexpr const_iterator begin() const noexcept { return array.begin(); }
+		constexpr const_iterator cbegin() const noexcept { return array.begin(); }
+
+		constexpr iterator end() noexcept { return array.end(); }
+		constexpr const_iterator end() const noexcept { return array.end(); }
+		constexpr const_iterator cend() const noexcept { return array.end(); }
+
+		/* Underlying data access.
+		*/
+		constexpr pointer data() noexcept { return array.data(); }
+		constexpr const_pointer data() const noexcept { return array.data(); }
+
+		/* Whether element `(i, j)` is stored, rather than known to be zero.
+		*/
+		static constexpr bool stored(std::size_t i, std::size_t j) noexcept {
+			return Packing::stored(i, j);
+		}
+
+		/* Element access operator. Only stored elements can be assigned to; reading the
+		 * others gives zero.
+		*/
+		constexpr Type& operator()(std::size_t i, std::size_t j) noexcept {
+			assert(stored(i, j));
+			return array[Packing::index(N, i, j)];
+		}
+
+		constexpr Type operator()(std::size_t i, std::size_t j) const noexcept {
+			return stored(i, j) ? array[Packing::index(N, i, j)] : Type();
+		}
+
+		/* Number of stored elements.
+		*/
+		constexpr size_type size() const noexcept {
+			return Packing::size(N);
+		}
+
+	};
+
+	/* Packed matrices.
+	*/
+	template<typename Type, std::size_t N>
+	using symmetric_matrix = packed_matrix<Type, N, detail::symmetric_packing>;
+
+	template<typename Type, std::size_t N>
+	using lower_triangular = packed_matrix<Type, N, detail::lower_packing>;
+
+	template<typename Type, std::size_t N>
+	using upper_triangular = packed_matrix<Type, N, detail::upper_packing>;
+
+	template<typename Type, std::size_t N>
+	using diagonal_matrix = packed_matrix<Type, N, detail::diagonal_packing>;
+
+	/* Equality operators, which compare the stored elements.
+	*/
+	template<typename LhsType, typename RhsType, std::size_t N, typename Packing>
+	constexpr bool operator==(packed_matrix<LhsType, N, Packing> const& lhs, packed_matrix<RhsType, N, Packing> const& rhs) {
+		for (std::size_t i = 0; i < lhs.size(); ++i) {
+			if (!(lhs.data()[i] == rhs.data()[i])) { return false; }
+		}
+		return true;
+	}
+
+	template<typename LhsType, typename RhsType, std::size_t N, typename Packing>
+	constexpr bool operator!=(packed_matrix<LhsType, N, Packing> const& lhs, packed_matrix<RhsType, N, Packing> const& rhs) {
+		return !(lhs == rhs);
+	}
+
+	/* Implementation of the `sor::order` metaprogramming function.
+	*/
+	template<typename Type, std::size_t N, typename Packing>
+	struct order<packed_matrix<Type, N, Packing>>
+		: public std::integral_constant<std::size_t, 2> {};
+
+	/* Implementation of the `sor::extent` metaprogramming function.
+	*/
+	template<typename Type, std::size_t N, typename Packing>
+	struct extent<packed_matrix<Type, N, Packing>, 0>
+		: public std::integral_constant<std::size_t, N> {};
+
+	template<typename Type, std::size_t N, typename Packing>
+	struct extent<packed_matrix<Type, N, Packing>, 1>
+		: public std::integral_constant<std::size_t, N> {};
+
+	/* Copies a packed matrix into a dense one, including its known elements.
+	*/
+	template<typename Type, std::size_t N, typename Packing>
+	constexpr matrix<Type, N, N> materialize(packed_matrix<Type, N, Packing> const& packed) {
+		matrix<Type, N, N> result{};
+		for (std::size_t i = 0; i < N; ++i) {
+			for (std::size_t j = 0; j < N; ++j) { result(i, j) = packed(i, j); }
+		}
+		return result;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "tensor.hpp"
+#include "matrix.hpp"
+#include "detail/tmp.hpp"
+
+namespace sor {
+
+	/* Granularity of the quantization parameters of a `quantized_tensor`: one scale
+	 * and zero point for the whole tensor, or one for each slice along the first axis,
+	 * such as the rows of a matrix.
+	*/
+	enum class quantization {
+		per_tensor,
+		per_row
+	};
+
+	/* Tensor of 8 bit integers standing for real numbers: the element `q` of group `g`
+	 * represents `scales[g] * (q - zero_points[g])`. The zero point is the integer
+	 * that represents zero exactly, so that padding and sparse weights stay exact.
+	 * Example:
+	 * 		sor::matrix<float, 2, 3> weights({
+	 * 			0.5f, -1.0f, 0.25f,
+	 * 			2.0f, 0.0f, -0.75f
+	 * 		});
+	 * 		auto q = sor::quantize<sor::quantization::per_row>(weights);
+	 * 		auto approximation = sor::dequantize(q); // within about half a scale of `weights`
+	*/
+	template<quantization Granularity, std::size_t... Dims>
+	struct quantized_tensor {
+
+		static_assert(sizeof...(Dims) > 0, "quantized tensors need at least one axis");
+
+		/* Number of groups sharing a scale and a zero point, and number of consecutive
+		 * elements in each.
+		*/
+		static constexpr std::size_t groups = Granularity == quantization::per_tensor
+			? 1 : detail::nth<0, Dims...>();
+		static constexpr std::size_t group_size = groups == 0
+			? 0 : detail::product<0, sizeof...(Dims), Dims...>() / groups;
+
+		tensor<std::int8_t, Dims...> values{};
+		std::array<float, groups> scales{};
+		std::array<std::int32_t, groups> zero_points{};
+
+	};
+
+	template<quantization Granularity, std::size_t M, std::size_t N>
+	using quantized_matrix = quantized_tensor<Granularity, M, N>;
+
+}
\ No newline at end of file
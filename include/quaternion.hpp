@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "vector.hpp"
+
+namespace sor {
+
+	/* Quaternion `w + x * i + y * j + z * k`, stored as the `vector<Type, 4>` of its
+	 * components in `x, y, z, w` order, so that the imaginary part comes first and the
+	 * usual `x`, `y`, `z`, `w` vector accessors apply to it. Unit quaternions
+	 * represent rotations.
+	 * Example:
+	 * 		sor::quaternion<double> q = sor::from_axis_angle(sor::vector<double, 3>({ 0, 0, 1 }), 0.5);
+	 * 		auto rotated = sor::rotate(q, sor::vector<double, 3>({ 1, 0, 0 }));
+	*/
+	template<typename Type>
+	struct quaternion {
+
+	private:
+
+		using container_type = sor::vector<Type, 4>;
+
+		container_type array;
+
+	public:
+
+		/* Type definitions
+		*/
+		using value_type = Type;
+
+		/* Regular copy and move constructors work as you would expect; the default one
+		 * gives the identity rotation.
+		*/
+		constexpr quaternion() noexcept(std::is_nothrow_default_constructible<Type>::value)
+			: array({ Type(), Type(), Type(), Type(1) }) {}
+		quaternion(quaternion const&) = default;
+		quaternion(quaternion&&) = default;
+
+		quaternion& operator=(quaternion const&) = default;
+		quaternion& operator=(quaternion&&) = default;
+
+		/* Initializes the components, imaginary part first.
+		*/
+		constexpr quaternion(Type x, Type y, Type z, Type w) noexcept(std::is_nothrow_copy_constructible<Type>::value)
+			: array({ x, y, z, w }) {}
+
+		/* Initializes the components from a vector, in `x, y, z, w` order.
+		*/
+		constexpr explicit quaternion(container_type const& values) noexcept(std::is_nothrow_copy_constructible<Type>::value)
+			: array(values) {}
+
+		/* Component access.
+		*/
+		constexpr Type& x() noexcept { return array[0]; }
+		constexpr Type const& x() const noexcept { return array[0]; }
+		constexpr Type& y() noexcept { return array[1]; }
+		constexpr Type const& y() const noexcept { return array[1]; }
+		constexpr Type& z() noexcept { return array[2]; }
+		constexpr Type const& z() const noexcept { return array[2]; }
+		constexpr Type& w() noexcept { return array[3]; }
+		constexpr Type const& w() const noexcept { return array[3]; }
+
+		/* The components as a vector, in `x, y, z, w` order.
+		*/
+		constexpr container_type& components() noexcept { return array; }
+		constexpr container_type const& components() const noexcept { return array; }
+
+		/* Imaginary part.
+		*/
+		constexpr sor::vector<Type, 3> imaginary() const noexcept {
+			return sor::vector<Type, 3>({ array[0], array[1], array[2] });
+		}
+
+	};
+
+	/* Equality operators, which compare the components.
+	*/
+	template<typename LhsType, typename RhsType>
+	constexpr bool operator==(quaternion<LhsType> const& lhs, quaternion<RhsType> const& rhs) {
+		return lhs.components() == rhs.components();
+	}
+
+	template<typename LhsType, typename RhsType>
+	constexpr bool operator!=(quaternion<LhsType> const& lhs, quaternion<RhsType> const& rhs) {
+		return !(lhs == rhs);
+	}
+
+	/* Rigid body transform: a rotation, given by a unit quaternion, followed by a
+	 * translation. The default one is the identity.
+	*/
+	template<typename Type>
+	struct rigid_transform {
+		quaternion<Type> rotation;
+		vector<Type, 3> translation{};
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,405 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <type_traits>
+
+#include "type_traits.hpp"
+#include "matrix.hpp"
+#include "detail/parallel.hpp"
+
+namespace sor {
+
+	/* Implementation details.
+	*/
+	namespace detail {
+
+		/* Minimum number of nonzero elements handled by each thread in the sparse
+		 * conversions and kernels, and minimum number of rows or columns.
+		*/
+		constexpr std::size_t sparse_grain = std::size_t(1) << 14;
+		constexpr std::size_t sparse_outer_grain = 256;
+
+		/* Compresses `count` coordinates along their `major` axis, which has `outer`
+		 * positions: `offsets[r]` becomes the start of the elements whose major index
+		 * is `r`, which are sorted by their `minor` index, with duplicates summed.
+		 * This is a parallel sort in two passes: a counting sort on the major index, in
+		 * which each thread counts and scatters a contiguous part of the input, and a
+		 * comparison sort of the (short) range of each major index.
+		*/
+		template<typename Type>
+		void compress(
+			std::size_t outer, std::size_t count,
+			std::size_t const* major, std::size_t const* minor, Type const* values,
+			std::vector<std::size_t>& offsets, std::vector<std::size_t>& indexes, std::vector<Type>& result
+		) {
+			std::size_t parts = std::min(thread_count(), count / sparse_grain);
+			if (parts == 0) { parts = 1; }
+			auto part_begin = [count, parts](std::size_t part) { return count * part / parts; };
+
+			std::vector<std::size_t> positions(parts * outer, 0);
+			parallel_for(parts, 1, [&](std::size_t first, std::size_t last) {
+				for (std::size_t part = first; part < last; ++part) {
+					std::size_t* const counts = positions.data() + part * outer;
+					for (std::size_t e = part_begin(part); e < part_begin(part + 1); ++e) { ++counts[major[e]]; }
+				}
+			});
+
+			std::vector<std::size_t> starts(outer + 1);
+			std::size_t total = 0;
+			for (std::size_t r = 0; r < outer; ++r) {
+				starts[r] = total;
+				for (std::size_t part = 0; part < parts; ++part) {
+					std::size_t const counted = positions[part * outer + r];
+					positions[part * outer + r] = total;
+					total += counted;
+				}
+			}
+			starts[outer] = total;
+
+			std::vector<std::pair<std::size_t, Type>> entries(count);
+			parallel_for(parts, 1, [&](std::size_t first, std::size_t last) {
+				for (std::size_t part = first; part < last; ++part) {
+					std::size_t* const next = positions.data() + part * outer;
+					for (std::size_t e = part_begin(part); e < part_begin(part + 1); ++e) {
+						entries[next[major[e]]++] = std::make_pair(minor[e], values[e]);
+					}
+				}
+			});
+
+			std::vector<std::size_t> kept(outer);
+			parallel_for(outer, sparse_outer_grain, [&](std::size_t first, std::size_t last) {
+				for (std::size_t r = first; r < last; ++r) {
+					auto const begin = entries.begin() + starts[r];
+					auto const end = entries.begin() + starts[r + 1];
+					std::sort(begin, end, [](auto const& lhs, auto const& rhs) { return lhs.first < rhs.first; });
+					auto out = begin;
+					for (auto it = begin; it != end; ++it) {
+						if (out != begin && (out - 1)->first == it->first) {
+							(out - 1)->second += it->second;
+						} else {
+							*out++ = *it;
+						}
+					}
+					kept[r] = std::size_t(out - begin);
+				}
+			});
+
+			offsets.assign(outer + 1, 0);
+			for (std::size_t r = 0; r < outer; ++r) { offsets[r + 1] = offsets[r] + kept[r]; }
+			indexes.resize(offsets[outer]);
+			result.resize(offsets[outer]);
+			parallel_for(outer, sparse_outer_grain, [&](std::size_t first, std::size_t last) {
+				for (std::size_t r = first; r < last; ++r) {
+					for (std::size_t e = 0; e < kept[r]; ++e) {
+						indexes[offsets[r] + e] = entries[starts[r] + e].first;
+						result[offsets[r] + e] = entries[starts[r] + e].second;
+					}
+				}
+			});
+		}
+
+		/* Storage of a compressed sparse matrix with `Outer` major positions, shared by
+		 * the CSR (major rows) and CSC (major columns) formats.
+		*/
+		template<typename Type, std::size_t Outer>
+		struct compressed_storage {
+
+			std::vector<std::size_t> offsets;
+			std::vector<std::size_t> indexes;
+			std::vector<Type> values;
+
+			compressed_storage()
+				: offsets(Outer + 1, 0) {}
+
+			compressed_storage(std::vector<std::size_t> offsets, std::vector<std::size_t> indexes, std::vector<Type> values)
+				: offsets(std::move(offsets)), indexes(std::move(indexes)), values(std::move(values)) {
+				assert(this->offsets.size() == Outer + 1);
+				assert(this->indexes.size() == this->offsets.back());
+				assert(this->values.size() == this->offsets.back());
+			}
+
+			/* The element at major index `major` and minor index `minor`, found by binary
+			 * search, or zero.
+			*/
+			Type find(std::size_t major, std::size_t minor) const {
+				auto const begin = indexes.begin() + offsets[major];
+				auto const end = indexes.begin() + offsets[major + 1];
+				auto const it = std::lower_bound(begin, end, minor);
+				return it != end && *it == minor ? values[std::size_t(it - indexes.begin())] : Type();
+			}
+
+		};
+
+	}
+
+	/* Sparse matrix in coordinate format: an unordered list of `(row, column, value)`
+	 * triplets, which is the cheapest to build. Duplicate coordinates are allowed and
+	 * stand for the sum of their values. Convert it to `csr_matrix` or `csc_matrix` for
+	 * arithmetic.
+	 * Example:
+	 * 		sor::coo_matrix<double, 1000, 1000> builder;
+	 * 		builder.insert(3, 7, 1.5);
+	 * 		sor::csr_matrix<double, 1000, 1000> a(builder);
+	*/
+	template<typename Type, std::size_t M, std::size_t N>
+	struct coo_matrix {
+
+	private:
+
+		std::vector<std::size_t> rows_;
+		std::vector<std::size_t> columns_;
+		std::vector<Type> values_;
+
+	public:
+
+		/* Type definitions
+		*/
+		using value_type = Type;
+		using size_type = std::size_t;
+
+		/* Adds `value` at the given coordinates.
+		*/
+		void insert(size_type row, size_type column, Type const& value) {
+			assert(row < M && column < N);
+			rows_.push_back(row);
+			columns_.push_back(column);
+			values_.push_back(value);
+		}
+
+		/* Allocates room for `count` triplets.
+		*/
+		void reserve(size_type count) {
+			rows_.reserve(count);
+			columns_.reserve(count);
+			values_.reserve(count);
+		}
+
+		/* Removes every triplet.
+		*/
+		void clear() noexcept {
+			rows_.clear();
+			columns_.clear();
+			values_.clear();
+		}
+
+		/* Number of stored triplets.
+		*/
+		size_type non_zeros() const noexcept { return values_.size(); }
+
+		/* Underlying data access.
+		*/
+		std::vector<size_type> const& row_indexes() const noexcept { return rows_; }
+		std::vector<size_type> const& column_indexes() const noexcept { return columns_; }
+		std::vector<Type> const& values() const noexcept { return values_; }
+
+	};
+
+	/* Sparse matrix in compressed sparse row format: the column indexes and values of
+	 * the nonzero elements of each row, sorted by column, with row `i` found at
+	 * `[row_offsets()[i], row_offsets()[i + 1])`.
+	*/
+	template<typename Type, std::size_t M, std::size_t N>
+	struct csr_matrix {
+
+	private:
+
+		detail::compressed_storage<Type, M> storage;
+
+	public:
+
+		/* Type definitions
+		*/
+		using value_type = Type;
+		using size_type = std::size_t;
+
+		/* An empty matrix.
+		*/
+		csr_matrix() = default;
+
+		/* Takes ownership of arrays that are already in the compressed format.
+		*/
+		csr_matrix(std::vector<size_type> offsets, std::vector<size_type> columns, std::vector<Type> values)
+			: storage(std::move(offsets), std::move(columns), std::move(values)) {}
+
+		/* Compresses a matrix in coordinate format, summing duplicates.
+		*/
+		explicit csr_matrix(coo_matrix<Type, M, N> const& coo) {
+			detail::compress(
+				M, coo.non_zeros(), coo.row_indexes().data(), coo.column_indexes().data(), coo.values().data(),
+				storage.offsets, storage.indexes, storage.values
+			);
+		}
+
+		/* Keeps the nonzero elements of a dense matrix.
+		*/
+		template<typename OtherType>
+		explicit csr_matrix(matrix<OtherType, M, N> const& dense) {
+			for (std::size_t i = 0; i < M; ++i) {
+				for (std::size_t j = 0; j < N; ++j) {
+					if (dense(i, j) != OtherType()) {
+						storage.indexes.push_back(j);
+						storage.values.push_back(dense(i, j));
+					}
+				}
+				storage.offsets[i + 1] = storage.values.size();
+			}
+		}
+
+		/* Element access, by binary search within the row.
+		*/
+		Type operator()(size_type i, size_type j) const {
+			return storage.find(i, j);
+		}
+
+		/* Number of stored elements.
+		*/
+		size_type non_zeros() const noexcept { return storage.values.size(); }
+
+		/* Underlying data access. The values can be modified, the structure can't.
+		*/
+		std::vector<size_type> const& row_offsets() const noexcept { return storage.offsets; }
+		std::vector<size_type> const& column_indexes() const noexcept { return storage.indexes; }
+		std::vector<Type> const& values() const noexcept { return storage.values; }
+		std::vector<Type>& values() noexcept { return storage.values; }
+
+	};
+
+	/* Sparse matrix in compressed sparse column format: the row indexes and values of
+	 * the nonzero elements of each column, sorted by row, with column `j` found at
+	 * `[column_offsets()[j], column_offsets()[j + 1])`.
+	*/
+	template<typename Type, std::size_t M, std::size_t N>
+	struct csc_matrix {
+
+	private:
+
+		detail::compressed_storage<Type, N> storage;
+
+	public:
+
+		/* Type definitions
+		*/
+		using value_type = Type;
+		using size_type = std::size_t;
+
+		/* An empty matrix.
+		*/
+		csc_matrix() = default;
+
+		/* Takes ownership of arrays that are already in the compressed format.
+		*/
+		csc_matrix(std::vector<size_type> offsets, std::vector<size_type> rows, std::vector<Type> values)
+			: storage(std::move(offsets), std::move(rows), std::move(values)) {}
+
+		/* Compresses a matrix in coordinate format, summing duplicates.
+		*/
+		explicit csc_matrix(coo_matrix<Type, M, N> const& coo) {
+			detail::compress(
+				N, coo.non_zeros(), coo.column_indexes().data(), coo.row_indexes().data(), coo.values().data(),
+				storage.offsets, storage.indexes, storage.values
+			);
+		}
+
+		/* Keeps the nonzero elements of a dense matrix.
+		*/
+		template<typename OtherType>
+		explicit csc_matrix(matrix<OtherType, M, N> const& dense) {
+			for (std::size_t j = 0; j < N; ++j) {
+				for (std::size_t i = 0; i < M; ++i) {
+					if (dense(i, j) != OtherType()) {
+						storage.indexes.push_back(i);
+						storage.values.push_back(dense(i, j));
+					}
+				}
+				storage.offsets[j + 1] = storage.values.size();
+			}
+		}
+
+		/* Element access, by binary search within the column.
+		*/
+		Type operator()(size_type i, size_type j) const {
+			return storage.find(j, i);
+		}
+
+		/* Number of stored elements.
+		*/
+		size_type non_zeros() const noexcept { return storage.values.size(); }
+
+		/* Underlying data access. The values can be modified, the structure can't.
+		*/
+		std::vector<size_type> const& column_offsets() const noexcept { return storage.offsets; }
+		std::vector<size_type> const& row_indexes() const noexcept { return storage.indexes; }
+		std::vector<Type> const& values() const noexcept { return storage.values; }
+		std::vector<Type>& values() noexcept { return storage.values; }
+
+	};
+
+	/* Implementation of the `sor::order` metaprogramming function.
+	*/
+	template<typename Type, std::size_t M, std::size_t N>
+	struct order<coo_matrix<Type, M, N>> : public std::integral_constant<std::size_t, 2> {};
+
+	template<typename Type, std::size_t M, std::size_t N>
+	struct order<csr_matrix<Type, M, N>> : public std::integral_constant<std::size_t, 2> {};
+
+	template<typename Type, std::size_t M, std::size_t N>
+	struct order<csc_matrix<Type, M, N>> : public std::integral_constant<std::size_t, 2> {};
+
+	/* Implementation of the `sor::extent` metaprogramming function.
+	*/
+	template<typename Type, std::size_t M, std::size_t N>
+	struct extent<coo_matrix<Type, M, N>, 0> : public std::integral_constant<std::size_t, M> {};
+
+	template<typename Type, std::size_t M, std::size_t N>
+	struct extent<coo_matrix<Type, M, N>, 1> : public std::integral_constant<std::size_t, N> {};
+
+	template<typename Type, std::size_t M, std::size_t N>
+	struct extent<csr_matrix<Type, M, N>, 0> : public std::integral_constant<std::size_t, M> {};
+
+	template<typename Type, std::size_t M, std::size_t N>
+	struct extent<csr_matrix<Type, M, N>, 1> : public std::integral_constant<std::size_t, N> {};
+
+	template<typename Type, std::size_t M, std::size_t N>
+	struct extent<csc_matrix<Type, M, N>, 0> : public std::integral_constant<std::size_t, M> {};
+
+	template<typename Type, std::size_t M, std::size_t N>
+	struct extent<csc_matrix<Type, M, N>, 1> : public std::integral_constant<std::size_t, N> {};
+
+	/* Copies sparse matrices into dense ones.
+	*/
+	template<typename Type, std::size_t M, std::size_t N>
+	matrix<Type, M, N> materialize(coo_matrix<Type, M, N> const& sparse) {
+		matrix<Type, M, N> result{};
+		for (std::size_t e = 0; e < sparse.non_zeros(); ++e) {
+			result(sparse.row_indexes()[e], sparse.column_indexes()[e]) += sparse.values()[e];
+		}
+		return result;
+	}
+
+	template<typename Type, std::size_t M, std::size_t N>
+	matrix<Type, M, N> materialize(csr_matrix<Type, M, N> const& sparse) {
+		matrix<Type, M, N> result{};
+		for (std::size_t i = 0; i < M; ++i) {
+			for (std::size_t e = sparse.row_offsets()[i]; e < sparse.row_offsets()[i + 1]; ++e) {
+				result(i, sparse.column_indexes()[e]) = sparse.values()[e];
+			}
+		}
+		return result;
+	}
+
+	template<typename Type, std::size_t M, std::size_t N>
+	matrix<Type, M, N> materialize(csc_matrix<Type, M, N> const& sparse) {
+		matrix<Type, M, N> result{};
+		for (std::size_t j = 0; j < N; ++j) {
+			for (std::size_t e = sparse.column_offsets()[j]; e < sparse.column_offsets()[j + 1]; ++e) {
+				result(sparse.row_indexes()[e], j) = sparse.values()[e];
+			}
+		}
+		return result;
+	}
+
+}
\ No newline at end of file
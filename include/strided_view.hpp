@@ -0,0 +1,137 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include "type_traits.hpp"
+#include "detail/tmp.hpp"
+#include "detail/permute.hpp"
+
+namespace sor {
+
+	template<typename Type, std::size_t... Dims>
+	struct tensor;
+
+	/* Non owning view of storage as a tensor with the given dimensions, whose axis `i`
+	 * has its elements `strides()[i]` apart. Strided views are obtained by permuting
+	 * the axes of a tensor via `tensor_facade::permute` and are valid as long as the
+	 * storage they refer to. Use `sor::materialize` to copy the elements into a tensor
+	 * with the permuted layout.
+	 * Example:
+	 * 		sor::tensor<int, 2, 3, 4> tensor;
+	 * 		auto view = tensor.permute<2, 0, 1>(); // sor::strided_view<int, 4, 2, 3>
+	 * 		view(3, 1, 2) = 1; // same as tensor(1, 2, 3) = 1
+	*/
+	template<typename Type, std::size_t... Dims>
+	struct strided_view {
+
+	public:
+
+		/* Type definitions
+		*/
+		using value_type = typename std::remove_cv<Type>::type;
+
+		using reference = Type&;
+		using const_reference = Type const&;
+
+		using pointer = Type*;
+		using const_pointer = Type const*;
+
+		using difference_type = std::ptrdiff_t;
+		using size_type = std::size_t;
+
+		using strides_type = std::array<std::size_t, sizeof...(Dims)>;
+
+	private:
+
+		pointer pointer_;
+		strides_type strides_;
+
+	public:
+
+		/* Views the elements starting at `data` with the given strides.
+		*/
+		constexpr strided_view(pointer data, strides_type const& strides) noexcept
+			: pointer_(data)
+			, strides_(strides) {}
+
+		/* Conversion from views of non constant elements to views of constant ones.
+		*/
+		template<typename OtherType,
+			typename std::enable_if<std::is_convertible<OtherType*, Type*>::value, int>::type = 0>
+		constexpr strided_view(strided_view<OtherType, Dims...> const& other) noexcept
+			: pointer_(other.data())
+			, strides_(other.strides()) {}
+
+		/* Underlying data access.
+		*/
+		constexpr pointer data() const noexcept { return pointer_; }
+		constexpr strides_type const& strides() const noexcept { return strides_; }
+
+		/* Element access operator, as for tensors.
+		*/
+		template<typename... Args,
+			typename std::enable_if<sizeof...(Args) == sizeof...(Dims), int>::type = 0>
+		constexpr Type& operator()(Args... args) const noexcept {
+			std::size_t const indexes[] = { static_cast<std::size_t>(args)... };
+			std::size_t offset = 0;
+			for (std::size_t i = 0; i < sizeof...(Dims); ++i) {
+				offset += indexes[i] * strides_[i];
+			}
+			return pointer_[offset];
+		}
+
+		/* Size related member functions
+		*/
+		constexpr size_type size() const noexcept {
+			return detail::multiply<Dims...>::value;
+		}
+
+		constexpr bool empty() const noexcept {
+			return size() == 0;
+		}
+
+		/* View of the same elements with permuted axes: axis `i` of the result is axis
+		 * `Perm[i]` of this view.
+		*/
+		template<std::size_t... Perm>
+		constexpr strided_view<Type, detail::nth<Perm, Dims...>()...> permute() const noexcept {
+			static_assert(sizeof...(Perm) == sizeof...(Dims), "a permutation must list every axis");
+			static_assert(detail::is_permutation<Perm...>(), "invalid permutation");
+			return strided_view<Type, detail::nth<Perm, Dims...>()...>(pointer_, { strides_[Perm]... });
+		}
+
+	};
+
+	/* Implementation of the `sor::order` metaprogramming function.
+	*/
+	template<typename Type, std::size_t... Dims>
+	struct order<strided_view<Type, Dims...>>
+		: public std::integral_constant<std::size_t, sizeof...(Dims)> {};
+
+	/* Implementation of the `sor::extent` metaprogramming function.
+	*/
+	template<typename Type, std::size_t... Dims, std::size_t Index>
+	struct extent<strided_view<Type, Dims...>, Index>
+		: public std::integral_constant<std::size_t, detail::nth<Index, Dims...>()> {};
+
+	/* Implementation of the `std::is_tensor` metaprogramming function.
+	*/
+	template<typename Type, std::size_t... Dims>
+	struct is_tensor<strided_view<Type, Dims...>> : std::true_type {};
+
+	/* Copies the elements of a strided view into a tensor with the same dimensions.
+	 * The copy is done a tile at a time, and split between threads for large views,
+	 * so that permuting large tensors avoids a cache miss per element (see
+	 * `detail::strided_copy` for the bandwidth it reaches).
+	*/
+	template<typename Type, std::size_t... Dims>
+	tensor<typename std::remove_cv<Type>::type, Dims...> materialize(strided_view<Type, Dims...> const& view) {
+		tensor<typename std::remove_cv<Type>::type, Dims...> result;
+		std::array<std::size_t, sizeof...(Dims)> const extents = { Dims... };
+		detail::strided_copy(view.data(), extents, view.strides(), result.data());
+		return result;
+	}
+
+}
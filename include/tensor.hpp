@@ -1,10 +1,16 @@
 #pragma once
 
 #include <algorithm>
+#include <functional>
 #include <type_traits>
 
 #include "type_traits.hpp"
 #include "tensor_facade.hpp"
+#include "tensor_view.hpp"
+#include "strided_view.hpp"
+#include "detail/tmp.hpp"
+#include "detail/equal.hpp"
+#include "detail/hash.hpp"
 
 namespace sor {
 
@@ -26,15 +32,9 @@ namespace sor {
 
 	/* Implementation of the `sor::extent` metaprogramming function.
 	*/
-	template<typename Type, std::size_t First, std::size_t... Dims, std::size_t Index>
-	struct extent<tensor<Type, First, Dims...>, Index>
-		: public std::integral_constant<std::size_t, 
-			extent<tensor<Type, Dims...>, Index - 1>::value
-		> {};
-
-	template<typename Type, std::size_t First, std::size_t... Dims>
-	struct extent<tensor<Type, First, Dims...>, 0>
-		: public std::integral_constant<std::size_t, First> {};
+	template<typename Type, std::size_t... Dims, std::size_t Index>
+	struct extent<tensor<Type, Dims...>, Index>
+		: public std::integral_constant<std::size_t, detail::nth<Index, Dims...>()> {};
 
 	/* Implementation of the `std::is_tensor` metaprogramming function.
 	*/
@@ -42,6 +42,9 @@ namespace sor {
 	struct is_tensor<tensor<Type, Dims...>> : std::true_type {};
 
 	/* Equality operators
+	 * Note: Tensors of integers are compared with `std::memcmp` and tensors of floating
+	 * point numbers with a vectorizable blocked loop; both exit at the first mismatching
+	 * block. Floating point semantics (`-0.0 == 0.0`, `NaN != NaN`) are preserved.
 	*/
 	template<typename LhsType, typename RhsType, std::size_t... LhsDims, std::size_t... RhsDims>
 	constexpr bool operator==(tensor<LhsType, LhsDims...> const&, tensor<RhsType, RhsDims...> const&) {
@@ -49,8 +52,8 @@ namespace sor {
 	}
 
 	template<typename LhsType, typename RhsType, std::size_t... CommonDims>
-	bool operator==(tensor<LhsType, CommonDims...> const& lhs, tensor<RhsType, CommonDims...> const& rhs) {
-		return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	constexpr bool operator==(tensor<LhsType, CommonDims...> const& lhs, tensor<RhsType, CommonDims...> const& rhs) {
+		return detail::equal(lhs.data(), rhs.data(), lhs.size());
 	}
 
 	template<typename LhsType, typename RhsType, std::size_t... LhsDims, std::size_t... RhsDims>
@@ -59,7 +62,7 @@ namespace sor {
 	}
 
 	template<typename LhsType, typename RhsType, std::size_t... CommonDims>
-	bool operator!=(tensor<LhsType, CommonDims...> const& lhs, tensor<RhsType, CommonDims...> const& rhs) {
+	constexpr bool operator!=(tensor<LhsType, CommonDims...> const& lhs, tensor<RhsType, CommonDims...> const& rhs) {
 		return !(lhs == rhs);
 	}
 
@@ -70,4 +73,21 @@ namespace sor {
 		lhs.swap(rhs);
 	}
 
+}
+
+namespace std {
+
+	/* Hash support, so that tensors can be used as keys of unordered containers.
+	 * Equal tensors hash equally: in particular `-0.0` and `0.0` elements hash the same,
+	 * and all NaN elements are hashed as the same quiet NaN. See `sor::detail::hash`.
+	*/
+	template<typename Type, std::size_t... Dims>
+	struct hash<sor::tensor<Type, Dims...>> {
+
+		std::size_t operator()(sor::tensor<Type, Dims...> const& tensor) const noexcept {
+			return static_cast<std::size_t>(sor::detail::hash(tensor.data(), tensor.size()));
+		}
+
+	};
+
 }
\ No newline at end of file
@@ -2,34 +2,42 @@
 
 #include <array>
 #include <algorithm>
+#include <utility>
 #include <type_traits>
 
 #include "type_traits.hpp"
 #include "detail/tmp.hpp"
+#include "detail/permute.hpp"
 
 namespace sor {
 
+	template<typename Type, std::size_t... Dims>
+	struct tensor;
+
+	template<typename Type, std::size_t... Dims>
+	struct tensor_view;
+
+	template<typename Type, std::size_t... Dims>
+	struct strided_view;
+
 	/* Implementation details.
 	*/
 	namespace detail {
 
+		/* Maps a set of indexes onto the position of the element in the row major
+		 * underlying array.
+		*/
 		template<std::size_t... Dims, typename... Args>
-		std::size_t flatten_indexes(Args... args) {
+		constexpr std::size_t flatten_indexes(Args... args) noexcept {
 
-			std::initializer_list<std::size_t> indexes = { static_cast<std::size_t>(args)... };
-			std::initializer_list<std::size_t> dimensions = { Dims... };
+			std::size_t const indexes[] = { static_cast<std::size_t>(args)... };
+			std::size_t const dimensions[] = { Dims... };
 
 			std::size_t index = 0;
-			auto last_index = indexes.end() - 1;
-			for (
-					auto i = indexes.begin(), d = dimensions.end() - 1; 
-					i < last_index && d >= dimensions.begin(); 
-					i++, d--
-				) {
-				index += *i;
-				index *= *d;
+			for (std::size_t i = 0; i < sizeof...(Dims); ++i) {
+				index *= dimensions[i];
+				index += indexes[i];
 			}
-			index += *last_index;
 
 			return index;
 
@@ -49,6 +57,16 @@ namespace sor {
 
 		container_type array;
 
+		static constexpr std::array<std::size_t, sizeof...(Dims)> row_major_strides() noexcept {
+			std::size_t const dims[] = { Dims... };
+			std::array<std::size_t, sizeof...(Dims)> strides{};
+			for (std::size_t i = sizeof...(Dims), stride = 1; i-- > 0;) {
+				strides[i] = stride;
+				stride *= dims[i];
+			}
+			return strides;
+		}
+
 	public:
 
 		/* Type definitions
@@ -84,8 +102,9 @@ namespace sor {
 		 * is nothrow assignable instead.
 		*/
 		template<typename OtherType>
-		tensor_facade(tensor_facade<OtherType, Dims...> const& other)
-				noexcept(std::is_nothrow_assignable<Type, OtherType>::value) {
+		constexpr tensor_facade(tensor_facade<OtherType, Dims...> const& other)
+				noexcept(std::is_nothrow_assignable<Type, OtherType>::value)
+			: array() {
 			(*this) = other;
 		}
 
@@ -93,11 +112,13 @@ namespace sor {
 		 * dimensions (left to right, top to bottom, front to back, etc...).
 		 * Note: It doesn't seem possible to initialize an `std::array` with an `std::initializer_list`;
 		 * this means that the exception specification needs to assert that the type is nothrow
-		 * assignable instead.
+		 * assignable instead. Elements past the end of the tensor are ignored and missing ones
+		 * are value initialized.
 		*/
 		template<typename OtherType>
-		explicit tensor_facade(std::initializer_list<OtherType> const& list)
-				noexcept(std::is_nothrow_assignable<Type, OtherType>::value) {
+		constexpr explicit tensor_facade(std::initializer_list<OtherType> const& list)
+				noexcept(std::is_nothrow_assignable<Type, OtherType>::value)
+			: array() {
 			(*this) = list;
 		}
 
@@ -107,18 +128,25 @@ namespace sor {
 		tensor_facade& operator=(tensor_facade&&) = default;
 
 		/* Templated copy assignment operator
+		 * Note: These are written as plain loops instead of `std::copy` so that they can be
+		 * evaluated in constant expressions.
 		*/
 		template<typename OtherType>
-		tensor_facade& operator=(tensor_facade<OtherType, Dims...> const& other)
+		constexpr tensor_facade& operator=(tensor_facade<OtherType, Dims...> const& other)
 				noexcept(std::is_nothrow_assignable<Type, OtherType>::value) {
-			std::copy(other.array.begin(), other.array.end(), array.begin());
+			for (std::size_t i = 0; i < size(); ++i) {
+				array[i] = other.array[i];
+			}
 			return (*this);
 		}
 
 		template<typename OtherType>
-		tensor_facade& operator=(std::initializer_list<OtherType> const& list)
+		constexpr tensor_facade& operator=(std::initializer_list<OtherType> const& list)
 				noexcept(std::is_nothrow_assignable<Type, OtherType>::value) {
-			std::copy(list.begin(), list.end(), array.begin());
+			auto it = list.begin();
+			for (std::size_t i = 0; i < size() && it != list.end(); ++i, ++it) {
+				array[i] = *it;
+			}
 			return (*this);
 		}
 
@@ -152,8 +180,8 @@ namespace sor {
 
 		/* Underlying data access.
 		*/
-		pointer data() noexcept { return array.data(); }
-		const_pointer data() const noexcept { return array.data(); }
+		constexpr pointer data() noexcept { return array.data(); }
+		constexpr const_pointer data() const noexcept { return array.data(); }
 
 		/* Swap function
 		*/
@@ -161,6 +189,72 @@ namespace sor {
 			array.swap(rhs.array);
 		}
 
+		/* Reshaping. The new dimensions must hold the same number of elements, which is
+		 * checked at compile time. Reshaping an lvalue returns a view of the same storage,
+		 * so that switching between batched and flattened forms costs nothing; reshaping
+		 * an rvalue moves its storage into a tensor with the new dimensions.
+		 * Example:
+		 * 		sor::tensor<int, 2, 3, 4> batch;
+		 * 		auto flat = batch.reshape<6, 4>(); // sor::tensor_view<int, 6, 4>
+		*/
+		template<std::size_t... NewDims>
+		constexpr tensor_view<Type, NewDims...> reshape() & noexcept {
+			static_assert(
+				detail::multiply<NewDims...>::value == detail::multiply<Dims...>::value,
+				"reshaping must preserve the number of elements"
+			);
+			return tensor_view<Type, NewDims...>(array.data());
+		}
+
+		template<std::size_t... NewDims>
+		constexpr tensor_view<Type const, NewDims...> reshape() const& noexcept {
+			static_assert(
+				detail::multiply<NewDims...>::value == detail::multiply<Dims...>::value,
+				"reshaping must preserve the number of elements"
+			);
+			return tensor_view<Type const, NewDims...>(array.data());
+		}
+
+		template<std::size_t... NewDims>
+		tensor<Type, NewDims...> reshape() &&
+				noexcept(std::is_nothrow_move_assignable<container_type>::value) {
+			static_assert(
+				detail::multiply<NewDims...>::value == detail::multiply<Dims...>::value,
+				"reshaping must preserve the number of elements"
+			);
+			tensor<Type, NewDims...> result;
+			static_cast<tensor_facade<Type, NewDims...>&>(result).array = std::move(array);
+			return result;
+		}
+
+		/* Axes permutation: axis `i` of the result is axis `Perm[i]` of this tensor.
+		 * Permuting an lvalue returns a lazy strided view of the same storage; use
+		 * `sor::materialize` on it to get a tensor. Permuting an rvalue directly returns
+		 * a tensor with the permuted layout.
+		 * Example:
+		 * 		sor::tensor<int, 2, 3, 4> tensor;
+		 * 		auto view = tensor.permute<2, 0, 1>(); // sor::strided_view<int, 4, 2, 3>
+		 * 		auto permuted = sor::materialize(view); // sor::tensor<int, 4, 2, 3>
+		*/
+		template<std::size_t... Perm>
+		constexpr strided_view<Type, detail::nth<Perm, Dims...>()...> permute() & noexcept {
+			return strided_view<Type, Dims...>(array.data(), row_major_strides()).template permute<Perm...>();
+		}
+
+		template<std::size_t... Perm>
+		constexpr strided_view<Type const, detail::nth<Perm, Dims...>()...> permute() const& noexcept {
+			return strided_view<Type const, Dims...>(array.data(), row_major_strides()).template permute<Perm...>();
+		}
+
+		template<std::size_t... Perm>
+		tensor<Type, detail::nth<Perm, Dims...>()...> permute() && {
+			static_assert(sizeof...(Perm) == sizeof...(Dims), "a permutation must list every axis");
+			static_assert(detail::is_permutation<Perm...>(), "invalid permutation");
+			tensor<Type, detail::nth<Perm, Dims...>()...> result;
+			detail::permute_copy<Dims...>(array.data(), result.data(), std::index_sequence<Perm...>());
+			return result;
+		}
+
 		/* Element access operator. It access the member based on the given indexes.
 		 * Example:
 		 * 		sor::tensor<int, 3, 4> matrix({
@@ -172,14 +266,14 @@ namespace sor {
 		*/
 		template<typename... Args,
 			typename std::enable_if<sizeof...(Args) == sizeof...(Dims), int>::type = 0>
-		Type& operator()(Args... args) noexcept {
+		constexpr Type& operator()(Args... args) noexcept {
 			auto index = detail::flatten_indexes<Dims...>(args...);
 			return array[index];
 		}
 
 		template<typename... Args,
 			typename std::enable_if<sizeof...(Args) == sizeof...(Dims), int>::type = 0>
-		Type const& operator()(Args... args) const noexcept {
+		constexpr Type const& operator()(Args... args) const noexcept {
 			auto index = detail::flatten_indexes<Dims...>(args...);
 			return array[index];
 		}
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "type_traits.hpp"
+#include "tensor_facade.hpp"
+#include "strided_view.hpp"
+#include "detail/tmp.hpp"
+
+namespace sor {
+
+	/* Non owning view of contiguous row major storage as a tensor with the given
+	 * dimensions. Views are obtained via `tensor_facade::reshape` and are valid as long
+	 * as the storage they refer to; copying a view never copies the elements. Views of
+	 * constant elements have a constant `Type`.
+	 * Example:
+	 * 		sor::tensor<int, 2, 3, 4> batch;
+	 * 		auto flat = batch.reshape<6, 4>();
+	 * 		flat(5, 3) = 1; // same as batch(1, 2, 3) = 1
+	*/
+	template<typename Type, std::size_t... Dims>
+	struct tensor_view {
+
+	private:
+
+		Type* pointer_;
+
+	public:
+
+		/* Type definitions
+		*/
+		using value_type = typename std::remove_cv<Type>::type;
+
+		using reference = Type&;
+		using const_reference = Type const&;
+
+		using pointer = Type*;
+		using const_pointer = Type const*;
+
+		using iterator = Type*;
+		using const_iterator = Type const*;
+
+		using reverse_iterator = std::reverse_iterator<iterator>;
+		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+		using difference_type = std::ptrdiff_t;
+		using size_type = std::size_t;
+
+		/* Views the `size()` elements starting at `data`.
+		*/
+		constexpr explicit tensor_view(pointer data) noexcept
+			: pointer_(data) {}
+
+		/* Conversion from views of non constant elements to views of constant ones.
+		*/
+		template<typename OtherType,
+			typename std::enable_if<std::is_convertible<OtherType*, Type*>::value, int>::type = 0>
+		constexpr tensor_view(tensor_view<OtherType, Dims...> const& other) noexcept
+			: pointer_(other.data()) {}
+
+		/* Iterators.
+		*/
+		constexpr iterator begin() const noexcept { return pointer_; }
+		constexpr const_iterator cbegin() const noexcept { return pointer_; }
+
+		constexpr iterator end() const noexcept { return pointer_ + size(); }
+		constexpr const_iterator cend() const noexcept { return pointer_ + size(); }
+
+		/* Reverse iterators.
+		*/
+		constexpr reverse_iterator rbegin() const noexcept { return reverse_iterator(end()); }
+		constexpr const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(cend()); }
+
+		constexpr reverse_iterator rend() const noexcept { return reverse_iterator(begin()); }
+		constexpr const_reverse_iterator crend() const noexcept { return const_reverse_iterator(cbegin()); }
+
+		/* Underlying data access.
+		*/
+		constexpr pointer data() const noexcept { return pointer_; }
+
+		/* Element access operator, as for tensors.
+		*/
+		template<typename... Args,
+			typename std::enable_if<sizeof...(Args) == sizeof...(Dims), int>::type = 0>
+		constexpr Type& operator()(Args... args) const noexcept {
+			return pointer_[detail::flatten_indexes<Dims...>(args...)];
+		}
+
+		/* Size related member functions
+		*/
+		constexpr size_type size() const noexcept {
+			return detail::multiply<Dims...>::value;
+		}
+
+		constexpr bool empty() const noexcept {
+			return size() == 0;
+		}
+
+		/* View of the same elements with other dimensions.
+		*/
+		template<std::size_t... NewDims>
+		constexpr tensor_view<Type, NewDims...> reshape() const noexcept {
+			static_assert(
+				detail::multiply<NewDims...>::value == detail::multiply<Dims...>::value,
+				"reshaping must preserve the number of elements"
+			);
+			return tensor_view<Type, NewDims...>(pointer_);
+		}
+
+		/* View of the same elements with permuted axes: axis `i` of the result is axis
+		 * `Perm[i]` of this view.
+		*/
+		template<std::size_t... Perm>
+		constexpr strided_view<Type, detail::nth<Perm, Dims...>()...> permute() const noexcept {
+			std::size_t const dims[] = { Dims... };
+			std::array<std::size_t, sizeof...(Dims)> strides{};
+			for (std::size_t i = sizeof...(Dims), stride = 1; i-- > 0;) {
+				strides[i] = stride;
+				stride *= dims[i];
+			}
+			return strided_view<Type, Dims...>(pointer_, strides).template permute<Perm...>();
+		}
+
+	};
+
+	/* Implementation of the `sor::order` metaprogramming function.
+	*/
+	template<typename Type, std::size_t... Dims>
+	struct order<tensor_view<Type, Dims...>>
+		: public std::integral_constant<std::size_t, sizeof...(Dims)> {};
+
+	/* Implementation of the `sor::extent` metaprogramming function.
+	*/
+	template<typename Type, std::size_t... Dims, std::size_t Index>
+	struct extent<tensor_view<Type, Dims...>, Index>
+		: public std::integral_constant<std::size_t, detail::nth<Index, Dims...>()> {};
+
+	/* Implementation of the `std::is_tensor` metaprogramming function.
+	*/
+	template<typename Type, std::size_t... Dims>
+	struct is_tensor<tensor_view<Type, Dims...>> : std::true_type {};
+
+	/* Copies the elements of a view into a tensor with the same dimensions.
+	*/
+	template<typename Type, std::size_t... Dims>
+	tensor<typename std::remove_cv<Type>::type, Dims...> materialize(tensor_view<Type, Dims...> const& view) {
+		tensor<typename std::remove_cv<Type>::type, Dims...> result;
+		for (std::size_t i = 0; i < view.size(); ++i) {
+			result.data()[i] = view.data()[i];
+		}
+		return result;
+	}
+
+}
@@ -31,4 +31,28 @@ namespace sor {
 	template<typename Type>
 	struct is_tensor : std::false_type {};
 
+	/* Metaprogramming function that returns the type in which sums of products of
+	 * elements of the given type are accumulated, by `dot_product`, matrix
+	 * multiplication and the reductions. It is the type itself, except for narrow
+	 * element types, such as `sor::float16`, which accumulate in a wider one.
+	*/
+	template<typename Type>
+	struct accumulation_type {
+		using type = Type;
+	};
+
+	/* Sums of products of 8 bit integers are accumulated in `int`, which holds the
+	 * sum of 2^16 products of `signed char`s exactly, at most 2^14 each, but only of
+	 * 2^15 products of `unsigned char`s, which reach 255 * 255.
+	*/
+	template<>
+	struct accumulation_type<signed char> {
+		using type = int;
+	};
+
+	template<>
+	struct accumulation_type<unsigned char> {
+		using type = int;
+	};
+
 }
\ No newline at end of file
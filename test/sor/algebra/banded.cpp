@@ -0,0 +1,117 @@
+#include <cmath>
+#include <cstddef>
+
+#include "../../../deps/catch/include/catch.hpp"
+#include "../../../include/vector.hpp"
+#include "../../../include/matrix.hpp"
+#include "../../../include/banded_matrix.hpp"
+#include "../../../include/algebra/matrix.hpp"
+#include "../../../include/algebra/banded.hpp"
+
+SCENARIO("banded matrix kernels", "[algebra]") {
+
+	GIVEN("a banded matrix and dense operands") {
+
+		constexpr std::size_t n = 17;
+		sor::banded_matrix<double, n, 2, 3> a;
+		for (std::size_t i = 0; i < n; ++i) {
+			for (std::size_t j = 0; j < n; ++j) {
+				if (a.stored(i, j)) { a(i, j) = i == j ? 8.0 : std::sin(double(i * n + j)); }
+			}
+		}
+		auto const dense = sor::materialize(a);
+
+		sor::vector<double, n> x;
+		sor::matrix<double, n, 3> b;
+		for (std::size_t i = 0; i < n; ++i) {
+			x[i] = std::cos(double(i));
+			for (std::size_t c = 0; c < 3; ++c) { b(i, c) = std::cos(double(i * 3 + c)); }
+		}
+
+		THEN("products match the dense ones") {
+
+			auto const y = a * x;
+			auto const c = a * b;
+			auto const expected = dense * b;
+			for (std::size_t i = 0; i < n; ++i) {
+				double sum = 0;
+				for (std::size_t j = 0; j < n; ++j) { sum += dense(i, j) * x[j]; }
+				REQUIRE(std::abs(y[i] - sum) < 1e-12);
+				for (std::size_t k = 0; k < 3; ++k) { REQUIRE(std::abs(c(i, k) - expected(i, k)) < 1e-12); }
+			}
+
+		}
+
+		THEN("solving undoes the products") {
+
+			auto const solution = sor::solve(a, a * x);
+			auto const solutions = sor::solve(a, a * b);
+			for (std::size_t i = 0; i < n; ++i) {
+				REQUIRE(std::abs(solution[i] - x[i]) < 1e-12);
+				for (std::size_t k = 0; k < 3; ++k) { REQUIRE(std::abs(solutions(i, k) - b(i, k)) < 1e-12); }
+			}
+
+		}
+
+	}
+
+	GIVEN("a tridiagonal system") {
+
+		sor::tridiagonal_matrix<double, 4> a;
+		for (std::size_t i = 0; i < 4; ++i) { a(i, i) = 2; }
+		for (std::size_t i = 1; i < 4; ++i) { a(i, i - 1) = a(i - 1, i) = -1; }
+		sor::vector<double, 4> b({ 1, 0, 0, 1 });
+
+		THEN("the Thomas algorithm solves it") {
+
+			auto const x = sor::solve(a, b);
+			for (std::size_t i = 0; i < 4; ++i) { REQUIRE(std::abs(x[i] - 1) < 1e-14); }
+
+		}
+
+	}
+
+	GIVEN("a batch of independent tridiagonal systems") {
+
+		constexpr std::size_t n = 12;
+		constexpr std::size_t batch = 300;
+		sor::matrix<double, n, batch> lower;
+		sor::matrix<double, n, batch> diagonal;
+		sor::matrix<double, n, batch> upper;
+		sor::matrix<double, n, batch> x;
+		for (std::size_t i = 0; i < n; ++i) {
+			for (std::size_t l = 0; l < batch; ++l) {
+				lower(i, l) = std::sin(double(i + l));
+				upper(i, l) = std::cos(double(i * l));
+				diagonal(i, l) = 3 + double(l % 5);
+				x(i, l) = std::sin(double(i * batch + l));
+			}
+		}
+		auto const rhs = x;
+
+		WHEN("we solve them at once") {
+
+			sor::tridiagonal_solve(lower, diagonal, upper, x);
+
+			THEN("each solution matches the one of its own system") {
+
+				for (std::size_t l = 0; l < batch; l += 37) {
+					sor::tridiagonal_matrix<double, n> a;
+					sor::vector<double, n> b;
+					for (std::size_t i = 0; i < n; ++i) {
+						a(i, i) = diagonal(i, l);
+						if (i > 0) { a(i, i - 1) = lower(i, l); }
+						if (i + 1 < n) { a(i, i + 1) = upper(i, l); }
+						b[i] = rhs(i, l);
+					}
+					auto const expected = sor::solve(a, b);
+					for (std::size_t i = 0; i < n; ++i) { REQUIRE(std::abs(x(i, l) - expected[i]) < 1e-12); }
+				}
+
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
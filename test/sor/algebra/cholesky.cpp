@@ -0,0 +1,166 @@
+#include <cmath>
+#include <cstddef>
+
+#include "../../../deps/catch/include/catch.hpp"
+#include "../../../include/tensor.hpp"
+#include "../../../include/vector.hpp"
+#include "../../../include/matrix.hpp"
+#include "../../../include/algebra/matrix.hpp"
+#include "../../../include/algebra/cholesky.hpp"
+
+SCENARIO("Cholesky decomposition of small matrices", "[algebra]") {
+
+	GIVEN("a symmetric positive definite matrix") {
+
+		sor::matrix<double, 3, 3> a({
+			4, 12, -16,
+			12, 37, -43,
+			-16, -43, 98
+		});
+
+		WHEN("we decompose it") {
+
+			auto cholesky = sor::cholesky_decompose(a);
+
+			THEN("we get its lower triangular factor") {
+
+				sor::matrix<double, 3, 3> expected({
+					2, 0, 0,
+					6, 1, 0,
+					-8, 5, 3
+				});
+				REQUIRE(cholesky.positive_definite);
+				for (std::size_t i = 0; i < 3; ++i) {
+					for (std::size_t j = 0; j < 3; ++j) {
+						REQUIRE(cholesky.lower(i, j) == Approx(expected(i, j)));
+					}
+				}
+
+			}
+
+			THEN("we can solve systems with it") {
+
+				auto x = sor::solve(cholesky, sor::vector<double, 3>({ -36, -105, 168 }));
+				REQUIRE(x[0] == Approx(1));
+				REQUIRE(x[1] == Approx(-2));
+				REQUIRE(x[2] == Approx(1));
+
+			}
+
+		}
+
+	}
+
+	GIVEN("a symmetric matrix that isn't positive definite") {
+
+		sor::matrix<double, 2, 2> a({
+			1, 2,
+			2, 1
+		});
+
+		WHEN("we decompose it in place") {
+
+			bool positive_definite = sor::cholesky_decompose_in_place(a);
+
+			THEN("the failure is reported") {
+
+				REQUIRE(!positive_definite);
+
+			}
+
+		}
+
+	}
+
+	GIVEN("a batch of matrices") {
+
+		sor::tensor<double, 3, 2, 2> batch({
+			4, 2, 2, 5,
+			1, 0, 0, 9,
+			1, 3, 3, 1
+		});
+
+		WHEN("we decompose and solve them in place") {
+
+			auto factorized = sor::cholesky_decompose_in_place(batch);
+			sor::tensor<double, 3, 2> b({ 8, 8, 2, 18, 0, 0 });
+			sor::cholesky_solve(batch, b);
+
+			THEN("every positive definite one is factorized and solved") {
+
+				REQUIRE(factorized[0]);
+				REQUIRE(factorized[1]);
+				REQUIRE(!factorized[2]);
+				REQUIRE(batch(0, 0, 0) == Approx(2));
+				REQUIRE(batch(0, 0, 1) == 0);
+				REQUIRE(batch(0, 1, 0) == Approx(1));
+				REQUIRE(batch(0, 1, 1) == Approx(2));
+				REQUIRE(b(0, 0) == Approx(1.5));
+				REQUIRE(b(0, 1) == Approx(1));
+				REQUIRE(b(1, 0) == Approx(2));
+				REQUIRE(b(1, 1) == Approx(2));
+
+			}
+
+		}
+
+	}
+
+}
+
+SCENARIO("Cholesky decomposition of large matrices", "[algebra]") {
+
+	GIVEN("a positive definite matrix spanning several panels") {
+
+		constexpr std::size_t n = 75;
+		static sor::matrix<double, n, n> m;
+		for (std::size_t i = 0; i < n; ++i) {
+			for (std::size_t j = 0; j < n; ++j) {
+				m(i, j) = std::sin(double(i * n + j));
+			}
+		}
+		static sor::matrix<double, n, n> a;
+		for (std::size_t i = 0; i < n; ++i) {
+			for (std::size_t j = 0; j < n; ++j) {
+				double sum = i == j ? 1 : 0;
+				for (std::size_t k = 0; k < n; ++k) { sum += m(i, k) * m(j, k); }
+				a(i, j) = sum;
+			}
+		}
+
+		WHEN("we decompose it") {
+
+			auto cholesky = sor::cholesky_decompose(a);
+
+			THEN("the product of the factor with its transpose is the matrix") {
+
+				REQUIRE(cholesky.positive_definite);
+				for (std::size_t i = 0; i < n; ++i) {
+					for (std::size_t j = 0; j < n; ++j) {
+						double sum = 0;
+						for (std::size_t k = 0; k < n; ++k) { sum += cholesky.lower(i, k) * cholesky.lower(j, k); }
+						REQUIRE(std::abs(sum - a(i, j)) < 1e-9);
+						if (j > i) { REQUIRE(cholesky.lower(i, j) == 0); }
+					}
+				}
+
+			}
+
+			THEN("we can solve systems with it") {
+
+				sor::vector<double, n> b;
+				for (std::size_t i = 0; i < n; ++i) { b[i] = std::cos(double(i)); }
+				auto x = sor::solve(cholesky, b);
+				for (std::size_t i = 0; i < n; ++i) {
+					double sum = 0;
+					for (std::size_t k = 0; k < n; ++k) { sum += a(i, k) * x[k]; }
+					REQUIRE(std::abs(sum - b[i]) < 1e-8);
+				}
+
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
@@ -593,4 +593,231 @@ SCENARIO("matrix scalar division", "[algebra]") {
 
 	}
 
+}
+
+SCENARIO("constant expression arithmetic", "[algebra]") {
+
+	GIVEN("two constant matrices") {
+
+		constexpr sor::matrix<int, 2, 2> matrix1({
+			1, 2,
+			3, 4
+		});
+		constexpr sor::matrix<int, 2, 2> matrix2({
+			4, 3,
+			2, 1
+		});
+
+		WHEN("we combine them in a constant expression") {
+
+			constexpr auto result = (matrix1 + matrix2) * 2 - (-matrix1) / 1;
+
+			THEN("the result is computed at compile time") {
+
+				constexpr sor::matrix<int, 2, 2> expected({
+					11, 12,
+					13, 14
+				});
+				constexpr bool is_expected = result == expected;
+				REQUIRE(is_expected);
+
+			}
+
+		}
+
+	}
+
+	GIVEN("a non constant vector") {
+
+		sor::vector<int, 3> vector({ 1, 2, 3 });
+
+		WHEN("we chain compound assignments") {
+
+			(vector *= 2) /= 2;
+
+			THEN("each assignment returns the vector itself") {
+
+				sor::vector<int, 3> expected({ 1, 2, 3 });
+				REQUIRE(vector == expected);
+
+			}
+
+		}
+
+	}
+
+}
+
+SCENARIO("tensor addition and subtraction", "[algebra]") {
+
+	GIVEN("two tensors of order three with the same extents") {
+
+		sor::tensor<int, 2, 2, 3> tensor1({
+			1, 2, 3,
+			4, 5, 6,
+
+			7, 8, 9,
+			10, 11, 12
+		});
+		sor::tensor<int, 2, 2, 3> tensor2({
+			10, 20, 30,
+			40, 50, 60,
+
+			70, 80, 90,
+			100, 110, 120
+		});
+
+		WHEN("we add and subtract them") {
+
+			auto sum = tensor1 + tensor2;
+			auto difference = tensor2 - tensor1;
+
+			THEN("the elements are added and subtracted one by one") {
+
+				for (std::size_t i = 0; i < 12; ++i) {
+					REQUIRE(sum.data()[i] == 11 * int(i + 1));
+					REQUIRE(difference.data()[i] == 9 * int(i + 1));
+				}
+
+			}
+
+		}
+
+		WHEN("we add and subtract them in place") {
+
+			tensor1 += tensor2;
+			tensor1 -= tensor2;
+			tensor1 -= tensor2;
+
+			THEN("the first tensor is updated") {
+
+				for (std::size_t i = 0; i < 12; ++i) {
+					REQUIRE(tensor1.data()[i] == -9 * int(i + 1));
+				}
+
+			}
+
+		}
+
+	}
+
+}
+
+SCENARIO("broadcasting sum and subtraction", "[algebra]") {
+
+	GIVEN("a matrix and a bias vector") {
+
+		sor::matrix<float, 2, 3> matrix({
+			1, 2, 3,
+			4, 5, 6
+		});
+		sor::vector<float, 3> bias({ 10, 20, 30 });
+
+		WHEN("we add the bias to the matrix") {
+
+			auto result = matrix + bias;
+
+			THEN("the bias is added to every row") {
+
+				sor::matrix<float, 2, 3> expected({
+					11, 22, 33,
+					14, 25, 36
+				});
+				REQUIRE(result == expected);
+
+			}
+
+		}
+
+		WHEN("we subtract the matrix from the bias") {
+
+			auto result = bias - matrix;
+
+			THEN("every row is subtracted from the bias") {
+
+				sor::matrix<float, 2, 3> expected({
+					9, 18, 27,
+					6, 15, 24
+				});
+				REQUIRE(result == expected);
+
+			}
+
+		}
+
+		WHEN("we add the bias in place") {
+
+			matrix += bias;
+			matrix -= sor::matrix<float, 1, 3>({ 1, 1, 1 });
+
+			THEN("the matrix is updated") {
+
+				sor::matrix<float, 2, 3> expected({
+					10, 21, 32,
+					13, 24, 35
+				});
+				REQUIRE(matrix == expected);
+
+			}
+
+		}
+
+	}
+
+	GIVEN("a column and a row") {
+
+		sor::matrix<int, 3, 1> column({ 1, 2, 3 });
+		sor::matrix<long, 1, 2> row({ 10, 20 });
+
+		WHEN("we add them") {
+
+			auto result = column + row;
+
+			THEN("both are broadcast to the common extents") {
+
+				sor::matrix<long, 3, 2> expected({
+					11, 21,
+					12, 22,
+					13, 23
+				});
+				REQUIRE(result == expected);
+
+			}
+
+		}
+
+	}
+
+	GIVEN("an order 3 tensor and a matrix") {
+
+		sor::tensor<int, 2, 2, 3> tensor({
+			1, 2, 3,
+			4, 5, 6,
+
+			7, 8, 9,
+			10, 11, 12
+		});
+		sor::matrix<int, 2, 1> matrix({ 100, 200 });
+
+		WHEN("we add them") {
+
+			auto result = tensor + matrix;
+
+			THEN("the matrix is repeated along the missing and unit axes") {
+
+				sor::tensor<int, 2, 2, 3> expected({
+					101, 102, 103,
+					204, 205, 206,
+
+					107, 108, 109,
+					210, 211, 212
+				});
+				REQUIRE(result == expected);
+
+			}
+
+		}
+
+	}
+
 }
\ No newline at end of file
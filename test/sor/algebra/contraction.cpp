@@ -0,0 +1,117 @@
+#include <type_traits>
+#include <numeric>
+
+#include "../../../deps/catch/include/catch.hpp"
+#include "../../../include/tensor.hpp"
+#include "../../../include/vector.hpp"
+#include "../../../include/matrix.hpp"
+#include "../../../include/algebra/matrix.hpp"
+#include "../../../include/algebra/contraction.hpp"
+
+SCENARIO("tensor contraction", "[algebra]") {
+
+	GIVEN("an order 3 tensor and a matrix") {
+
+		sor::tensor<int, 2, 3, 4> lhs;
+		std::iota(lhs.begin(), lhs.end(), 0);
+		sor::matrix<long, 4, 2> rhs({
+			1, 0,
+			0, 1,
+			1, 0,
+			0, -1
+		});
+
+		WHEN("we contract the last axis of the first with the first axis of the second") {
+
+			auto result = sor::contract<2, 0>(lhs, rhs);
+
+			THEN("each row of the tensor is multiplied by the matrix") {
+
+				constexpr bool is_expected_type = std::is_same<
+					decltype(result),
+					sor::tensor<long, 2, 3, 2>
+				>::value;
+				REQUIRE(is_expected_type);
+
+				for (std::size_t i = 0; i < 2; ++i) {
+					for (std::size_t j = 0; j < 3; ++j) {
+						REQUIRE(result(i, j, 0) == lhs(i, j, 0) + lhs(i, j, 2));
+						REQUIRE(result(i, j, 1) == lhs(i, j, 1) - lhs(i, j, 3));
+					}
+				}
+
+			}
+
+		}
+
+	}
+
+	GIVEN("two order 3 tensors sharing an inner extent") {
+
+		sor::tensor<int, 2, 3, 4> lhs;
+		std::iota(lhs.begin(), lhs.end(), 1);
+		sor::tensor<int, 5, 3, 2> rhs;
+		std::iota(rhs.begin(), rhs.end(), -10);
+
+		WHEN("we contract the middle axes") {
+
+			auto result = sor::contract<1, 1>(lhs, rhs);
+
+			THEN("we get the sum of products along those axes") {
+
+				constexpr bool is_expected_type = std::is_same<
+					decltype(result),
+					sor::tensor<int, 2, 4, 5, 2>
+				>::value;
+				REQUIRE(is_expected_type);
+
+				bool all_equal = true;
+				for (std::size_t i = 0; i < 2; ++i) {
+					for (std::size_t k = 0; k < 4; ++k) {
+						for (std::size_t l = 0; l < 5; ++l) {
+							for (std::size_t n = 0; n < 2; ++n) {
+								int expected = 0;
+								for (std::size_t j = 0; j < 3; ++j) {
+									expected += lhs(i, j, k) * rhs(l, j, n);
+								}
+								all_equal = all_equal && result(i, k, l, n) == expected;
+							}
+						}
+					}
+				}
+				REQUIRE(all_equal);
+
+			}
+
+		}
+
+	}
+
+	GIVEN("two matrices and two vectors") {
+
+		sor::matrix<int, 2, 3> matrix1({
+			1, 2, 3,
+			4, 5, 6
+		});
+		sor::matrix<int, 3, 2> matrix2({
+			1, 2,
+			3, 4,
+			5, 6
+		});
+		sor::vector<int, 3> vector1({ 1, 2, 3 });
+		sor::vector<int, 3> vector2({ 4, 5, 6 });
+
+		WHEN("we contract them") {
+
+			THEN("we get the matrix product and the dot product") {
+
+				REQUIRE((sor::contract<1, 0>(matrix1, matrix2) == matrix1 * matrix2));
+				REQUIRE((sor::contract<0, 0>(vector1, vector2) == 32));
+
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,151 @@
+#include <cmath>
+#include <cstddef>
+
+#include "../../../deps/catch/include/catch.hpp"
+#include "../../../include/vector.hpp"
+#include "../../../include/matrix.hpp"
+#include "../../../include/algebra/eigen.hpp"
+
+namespace {
+
+	/* Checks that `eigen` diagonalizes `a` with orthonormal eigenvectors.
+	*/
+	template<typename Type, std::size_t N>
+	void check_decomposition(sor::matrix<Type, N, N> const& a, sor::eigen_decomposition<Type, N> const& eigen, double tolerance) {
+		REQUIRE(eigen.converged);
+		for (std::size_t i = 0; i + 1 < N; ++i) {
+			REQUIRE(eigen.values[i] <= eigen.values[i + 1]);
+		}
+		for (std::size_t i = 0; i < N; ++i) {
+			for (std::size_t j = 0; j < N; ++j) {
+				double product = 0, dot = 0;
+				for (std::size_t k = 0; k < N; ++k) {
+					product += a(i, k) * eigen.vectors(k, j);
+					dot += eigen.vectors(k, i) * eigen.vectors(k, j);
+				}
+				REQUIRE(std::abs(product - eigen.values[j] * eigen.vectors(i, j)) < tolerance);
+				REQUIRE(std::abs(dot - (i == j ? 1 : 0)) < tolerance);
+			}
+		}
+	}
+
+}
+
+SCENARIO("eigenvalue decomposition of 3 x 3 matrices", "[algebra]") {
+
+	GIVEN("a symmetric matrix with a repeated eigenvalue") {
+
+		sor::matrix<double, 3, 3> a({
+			2, 1, 0,
+			1, 2, 0,
+			0, 0, 3
+		});
+
+		WHEN("we decompose it") {
+
+			auto eigen = sor::symmetric_eigen_decompose(a);
+
+			THEN("we get its eigenvalues in ascending order and their eigenvectors") {
+
+				REQUIRE(eigen.values[0] == Approx(1));
+				REQUIRE(eigen.values[1] == Approx(3));
+				REQUIRE(eigen.values[2] == Approx(3));
+				check_decomposition(a, eigen, 1e-12);
+
+			}
+
+		}
+
+	}
+
+	GIVEN("a dense symmetric matrix") {
+
+		sor::matrix<float, 3, 3> a({
+			4.0f, 1.0f, -2.0f,
+			1.0f, -3.0f, 0.5f,
+			-2.0f, 0.5f, 7.0f
+		});
+
+		WHEN("we decompose it") {
+
+			auto eigen = sor::symmetric_eigen_decompose(a);
+
+			THEN("it is diagonalized") {
+
+				check_decomposition(a, eigen, 1e-5);
+
+			}
+
+		}
+
+	}
+
+}
+
+SCENARIO("eigenvalue decomposition of large matrices", "[algebra]") {
+
+	GIVEN("a symmetric matrix") {
+
+		constexpr std::size_t n = 40;
+		static sor::matrix<double, n, n> a;
+		for (std::size_t i = 0; i < n; ++i) {
+			for (std::size_t j = 0; j <= i; ++j) {
+				a(i, j) = a(j, i) = std::sin(double(i * n + j));
+			}
+		}
+
+		WHEN("we decompose it") {
+
+			auto eigen = sor::symmetric_eigen_decompose(a);
+			auto values = sor::symmetric_eigenvalues(a);
+
+			THEN("it is diagonalized") {
+
+				check_decomposition(a, eigen, 1e-10);
+
+			}
+
+			THEN("the eigenvalues alone are the same") {
+
+				for (std::size_t i = 0; i < n; ++i) {
+					REQUIRE(values[i] == Approx(eigen.values[i]));
+				}
+
+			}
+
+			THEN("their sum is the trace") {
+
+				double trace = 0, sum = 0;
+				for (std::size_t i = 0; i < n; ++i) {
+					trace += a(i, i);
+					sum += values[i];
+				}
+				REQUIRE(sum == Approx(trace));
+
+			}
+
+		}
+
+	}
+
+	GIVEN("a diagonal matrix") {
+
+		sor::matrix<double, 5, 5> a{};
+		for (std::size_t i = 0; i < 5; ++i) { a(i, i) = 5.0 - i; }
+
+		WHEN("we decompose it") {
+
+			auto eigen = sor::symmetric_eigen_decompose(a);
+
+			THEN("the eigenvalues are the diagonal, sorted") {
+
+				for (std::size_t i = 0; i < 5; ++i) { REQUIRE(eigen.values[i] == Approx(i + 1.0)); }
+				check_decomposition(a, eigen, 1e-12);
+
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,189 @@
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+
+#include "../../../deps/catch/include/catch.hpp"
+#include "../../../include/vector.hpp"
+#include "../../../include/matrix.hpp"
+#include "../../../include/algebra/fft.hpp"
+
+namespace {
+
+	/* Discrete Fourier transform by its definition, in `O(N^2)` operations.
+	*/
+	template<std::size_t N>
+	sor::vector<std::complex<double>, N> reference(sor::vector<std::complex<double>, N> const& x) {
+		long double const pi = 3.14159265358979323846264338327950288L;
+		sor::vector<std::complex<double>, N> result{};
+		for (std::size_t k = 0; k < N; ++k) {
+			std::complex<long double> sum = 0;
+			for (std::size_t n = 0; n < N; ++n) {
+				long double const angle = -2 * pi * (long double)(k * n % N) / N;
+				sum += std::complex<long double>(x(n).real(), x(n).imag()) * std::complex<long double>(std::cos(angle), std::sin(angle));
+			}
+			result(k) = std::complex<double>(double(sum.real()), double(sum.imag()));
+		}
+		return result;
+	}
+
+	/* Deterministic test sequence.
+	*/
+	template<std::size_t N>
+	sor::vector<std::complex<double>, N> sequence() {
+		sor::vector<std::complex<double>, N> x;
+		for (std::size_t i = 0; i < N; ++i) { x(i) = std::complex<double>(std::sin(0.7 * i + 0.3), std::cos(1.3 * i) - 0.25); }
+		return x;
+	}
+
+	/* Largest absolute difference between the elements of two complex sequences.
+	*/
+	template<std::size_t N>
+	double distance(sor::vector<std::complex<double>, N> const& lhs, sor::vector<std::complex<double>, N> const& rhs) {
+		double result = 0;
+		for (std::size_t i = 0; i < N; ++i) { result = std::max(result, std::abs(lhs(i) - rhs(i))); }
+		return result;
+	}
+
+	template<std::size_t N>
+	void check_length() {
+		sor::vector<std::complex<double>, N> const x = sequence<N>();
+		REQUIRE(distance(sor::fft(x), reference(x)) < 1e-11);
+		REQUIRE(distance(sor::inverse_fft(sor::fft(x)), x) < 1e-13);
+	}
+
+	template<std::size_t N>
+	void check_real_length() {
+		sor::vector<double, N> x;
+		sor::vector<std::complex<double>, N> z;
+		for (std::size_t i = 0; i < N; ++i) { z(i) = x(i) = std::sin(0.9 * i) + 0.1 * i; }
+		sor::vector<std::complex<double>, N> const expected = reference(z);
+		sor::vector<std::complex<double>, N / 2 + 1> const spectrum = sor::rfft(x);
+		for (std::size_t k = 0; k <= N / 2; ++k) { REQUIRE(std::abs(spectrum(k) - expected(k)) < 1e-11); }
+		sor::vector<double, N> const back = sor::inverse_rfft<N>(spectrum);
+		for (std::size_t i = 0; i < N; ++i) { REQUIRE(std::abs(back(i) - x(i)) < 1e-12); }
+	}
+
+}
+
+SCENARIO("the FFT of a vector", "[fft]") {
+
+	GIVEN("a short sequence") {
+
+		sor::vector<std::complex<double>, 4> x({ 1, 2, 3, 4 });
+
+		WHEN("it is transformed") {
+
+			sor::vector<std::complex<double>, 4> spectrum = sor::fft(x);
+
+			THEN("it gives the DFT") {
+				REQUIRE(std::abs(spectrum(0) - std::complex<double>(10, 0)) < 1e-15);
+				REQUIRE(std::abs(spectrum(1) - std::complex<double>(-2, 2)) < 1e-15);
+				REQUIRE(std::abs(spectrum(2) - std::complex<double>(-2, 0)) < 1e-15);
+				REQUIRE(std::abs(spectrum(3) - std::complex<double>(-2, -2)) < 1e-15);
+			}
+
+		}
+
+	}
+
+	GIVEN("sequences of lengths with mixed factors") {
+
+		THEN("the FFT matches the DFT and is undone by the inverse") {
+			check_length<1>();
+			check_length<2>();
+			check_length<3>();
+			check_length<5>();
+			check_length<7>();
+			check_length<8>();
+			check_length<12>();
+			check_length<30>();
+			check_length<45>();
+			check_length<64>();
+			check_length<98>();
+			check_length<210>();
+			check_length<256>();
+			check_length<1024>();
+		}
+
+	}
+
+	GIVEN("the twiddle factors") {
+
+		THEN("they are computed at compile time") {
+			constexpr auto const& table = sor::detail::twiddles<double, 8>::value;
+			static_assert(table.re[0] == 1 && table.im[0] == 0, "twiddle factors are constant expressions");
+			static_assert(table.re[2] == 0 && table.im[2] == -1, "quarter turns are exact");
+			REQUIRE(std::abs(table.re[1] - std::sqrt(0.5)) < 1e-16);
+			REQUIRE(std::abs(table.im[1] + std::sqrt(0.5)) < 1e-16);
+		}
+
+	}
+
+}
+
+SCENARIO("the FFT of a real vector", "[fft]") {
+
+	GIVEN("real sequences of even and odd lengths") {
+
+		THEN("rfft gives the first half of the DFT, and inverse_rfft gives the sequence back") {
+			check_real_length<1>();
+			check_real_length<2>();
+			check_real_length<4>();
+			check_real_length<9>();
+			check_real_length<10>();
+			check_real_length<16>();
+			check_real_length<60>();
+			check_real_length<512>();
+		}
+
+	}
+
+}
+
+SCENARIO("the FFT of a matrix", "[fft]") {
+
+	GIVEN("a matrix") {
+
+		constexpr std::size_t M = 24;
+		constexpr std::size_t N = 40;
+		sor::matrix<std::complex<double>, M, N> x;
+		for (std::size_t i = 0; i < M; ++i) {
+			for (std::size_t j = 0; j < N; ++j) { x(i, j) = std::complex<double>(std::sin(0.3 * i + 0.7 * j), std::cos(0.5 * i * j)); }
+		}
+
+		WHEN("it is transformed") {
+
+			sor::matrix<std::complex<double>, M, N> spectrum = sor::fft(x);
+
+			THEN("the rows and then the columns are transformed") {
+				sor::matrix<std::complex<double>, M, N> expected;
+				for (std::size_t i = 0; i < M; ++i) {
+					sor::vector<std::complex<double>, N> row;
+					for (std::size_t j = 0; j < N; ++j) { row(j) = x(i, j); }
+					row = reference(row);
+					for (std::size_t j = 0; j < N; ++j) { expected(i, j) = row(j); }
+				}
+				for (std::size_t j = 0; j < N; ++j) {
+					sor::vector<std::complex<double>, M> column;
+					for (std::size_t i = 0; i < M; ++i) { column(i) = expected(i, j); }
+					column = reference(column);
+					for (std::size_t i = 0; i < M; ++i) { expected(i, j) = column(i); }
+				}
+				for (std::size_t i = 0; i < M; ++i) {
+					for (std::size_t j = 0; j < N; ++j) { REQUIRE(std::abs(spectrum(i, j) - expected(i, j)) < 1e-10); }
+				}
+			}
+
+			THEN("the inverse gives the matrix back") {
+				sor::matrix<std::complex<double>, M, N> back = sor::inverse_fft(spectrum);
+				for (std::size_t i = 0; i < M; ++i) {
+					for (std::size_t j = 0; j < N; ++j) { REQUIRE(std::abs(back(i, j) - x(i, j)) < 1e-13); }
+				}
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
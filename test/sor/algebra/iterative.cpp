@@ -0,0 +1,259 @@
+#include <cmath>
+#include <cstddef>
+
+#include "../../../deps/catch/include/catch.hpp"
+#include "../../../include/vector.hpp"
+#include "../../../include/matrix.hpp"
+#include "../../../include/sparse_matrix.hpp"
+#include "../../../include/algebra/sparse.hpp"
+#include "../../../include/algebra/iterative.hpp"
+
+namespace {
+
+	constexpr std::size_t width = 16;
+	constexpr std::size_t n = width * width;
+
+	/* Discretization of `-laplacian(u) + convection * du/dx` on a `width` x `width`
+	 * grid, which is symmetric positive definite without convection.
+	*/
+	sor::csr_matrix<double, n, n> make_poisson(double convection) {
+		sor::coo_matrix<double, n, n> coo;
+		for (std::size_t r = 0; r < width; ++r) {
+			for (std::size_t c = 0; c < width; ++c) {
+				std::size_t const i = r * width + c;
+				coo.insert(i, i, 4);
+				if (r > 0) { coo.insert(i, i - width, -1); }
+				if (r + 1 < width) { coo.insert(i, i + width, -1); }
+				if (c > 0) { coo.insert(i, i - 1, -1 - convection); }
+				if (c + 1 < width) { coo.insert(i, i + 1, -1 + convection); }
+			}
+		}
+		return sor::csr_matrix<double, n, n>(coo);
+	}
+
+	/* Relative residual norm of `x` as a solution of `A * x = b`.
+	*/
+	template<typename Matrix, std::size_t N>
+	double residual(Matrix const& a, sor::vector<double, N> const& b, sor::vector<double, N> const& x) {
+		auto const product = a * x;
+		double squares = 0;
+		double norm = 0;
+		for (std::size_t i = 0; i < N; ++i) {
+			squares += (b[i] - product[i]) * (b[i] - product[i]);
+			norm += b[i] * b[i];
+		}
+		return std::sqrt(squares / norm);
+	}
+
+}
+
+SCENARIO("iterative solvers on dense matrices", "[algebra]") {
+
+	GIVEN("a diagonally dominant symmetric system") {
+
+		sor::matrix<double, 4, 4> a({
+			10, -1, 2, 0,
+			-1, 11, -1, 3,
+			2, -1, 10, -1,
+			0, 3, -1, 8
+		});
+		sor::vector<double, 4> b({ 6, 25, -11, 15 });
+		sor::vector<double, 4> expected({ 1, 2, -1, 1 });
+		sor::iteration_limits<double> limits;
+		limits.tolerance = 1e-12;
+		sor::iterative_workspace<double> workspace;
+
+		auto check = [&](sor::iterative_result<double> const& result, sor::vector<double, 4> const& x) {
+			REQUIRE(result.converged);
+			REQUIRE(result.residual <= 1e-12);
+			for (std::size_t i = 0; i < 4; ++i) { REQUIRE(std::abs(x[i] - expected[i]) < 1e-9); }
+		};
+
+		THEN("every solver finds the solution") {
+
+			sor::vector<double, 4> x{};
+			check(sor::jacobi_solve(a, b, x, limits, workspace), x);
+			x = sor::vector<double, 4>{};
+			check(sor::gauss_seidel_solve(a, b, x, limits, workspace), x);
+			x = sor::vector<double, 4>{};
+			check(sor::sor_solve(a, b, x, 1.1, limits, workspace), x);
+			x = sor::vector<double, 4>{};
+			check(sor::ssor_solve(a, b, x, 1.1, limits, workspace), x);
+			x = sor::vector<double, 4>{};
+			auto const result = sor::conjugate_gradient_solve(a, b, x, limits, workspace);
+			check(result, x);
+			REQUIRE(result.iterations <= 4);
+			x = sor::vector<double, 4>{};
+			check(sor::bicgstab_solve(a, b, x, limits, workspace), x);
+
+		}
+
+		THEN("Gauss-Seidel converges faster than Jacobi") {
+
+			sor::vector<double, 4> x{};
+			auto const jacobi = sor::jacobi_solve(a, b, x, limits, workspace);
+			x = sor::vector<double, 4>{};
+			auto const gauss_seidel = sor::gauss_seidel_solve(a, b, x, limits, workspace);
+			REQUIRE(gauss_seidel.iterations < jacobi.iterations);
+
+		}
+
+		WHEN("the initial guess is the solution") {
+
+			sor::vector<double, 4> x(expected);
+			auto const result = sor::conjugate_gradient_solve(a, b, x, limits, workspace);
+
+			THEN("no iteration is needed") {
+
+				REQUIRE(result.converged);
+				REQUIRE(result.iterations == 0);
+
+			}
+
+		}
+
+	}
+
+	GIVEN("a system with more rows than a thread sums at once") {
+
+		constexpr std::size_t size = 300;
+		static sor::matrix<double, size, size> a;
+		sor::vector<double, size> b;
+		for (std::size_t i = 0; i < size; ++i) {
+			for (std::size_t j = 0; j < size; ++j) { a(i, j) = i == j ? 2.0 * size : std::sin(double(i * size + j)); }
+			b[i] = std::cos(double(i));
+		}
+		sor::iteration_limits<double> limits;
+		sor::iterative_workspace<double> workspace;
+
+		THEN("repeated solves give the same iterates and residuals") {
+
+			sor::vector<double, size> first{};
+			sor::vector<double, size> second{};
+			auto const result1 = sor::jacobi_solve(a, b, first, limits, workspace);
+			auto const result2 = sor::jacobi_solve(a, b, second, limits, workspace);
+			REQUIRE(workspace.partials.size() > 1);
+			REQUIRE(result1.converged);
+			REQUIRE(result1.iterations == result2.iterations);
+			REQUIRE(result1.residual == result2.residual);
+			REQUIRE((first == second));
+
+		}
+
+	}
+
+}
+
+SCENARIO("iterative solvers on sparse matrices", "[algebra]") {
+
+	GIVEN("a discretized Poisson problem") {
+
+		auto const a = make_poisson(0);
+		sor::vector<double, n> b;
+		for (std::size_t i = 0; i < n; ++i) { b[i] = std::sin(double(i)); }
+		sor::iteration_limits<double> limits;
+		limits.tolerance = 1e-8;
+		limits.iterations = 5000;
+		sor::iterative_workspace<double> workspace;
+
+		THEN("the relaxation methods converge") {
+
+			sor::vector<double, n> x{};
+			auto const jacobi = sor::jacobi_solve(a, b, x, limits, workspace);
+			REQUIRE(jacobi.converged);
+			REQUIRE(residual(a, b, x) < 1e-7);
+
+			x = sor::vector<double, n>{};
+			auto const gauss_seidel = sor::gauss_seidel_solve(a, b, x, limits, workspace);
+			REQUIRE(gauss_seidel.converged);
+			REQUIRE(residual(a, b, x) < 1e-7);
+
+			x = sor::vector<double, n>{};
+			auto const over_relaxed = sor::sor_solve(a, b, x, 1.7, limits, workspace);
+			REQUIRE(over_relaxed.converged);
+			REQUIRE(residual(a, b, x) < 1e-7);
+			REQUIRE(over_relaxed.iterations < gauss_seidel.iterations);
+			REQUIRE(gauss_seidel.iterations < jacobi.iterations);
+
+			x = sor::vector<double, n>{};
+			auto const symmetric = sor::ssor_solve(a, b, x, 1.5, limits, workspace);
+			REQUIRE(symmetric.converged);
+			REQUIRE(residual(a, b, x) < 1e-7);
+
+		}
+
+		THEN("the grid is relaxed in red-black order") {
+
+			sor::vector<double, n> x{};
+			sor::gauss_seidel_solve(a, b, x, limits, workspace);
+			REQUIRE(workspace.colors.size() == 3);
+			REQUIRE(workspace.colors[1] == n / 2);
+			for (std::size_t k = 0; k < n; ++k) {
+				std::size_t const i = workspace.order[k];
+				REQUIRE((i / width + i % width) % 2 == (k < n / 2 ? 0u : 1u));
+			}
+
+		}
+
+		THEN("the conjugate gradient method converges") {
+
+			sor::vector<double, n> x{};
+			auto const result = sor::conjugate_gradient_solve(a, b, x, limits, workspace);
+			REQUIRE(result.converged);
+			REQUIRE(result.iterations < 100);
+			REQUIRE(residual(a, b, x) < 1e-7);
+
+		}
+
+		THEN("a monitor sees every iteration and can stop the solver") {
+
+			std::size_t calls = 0;
+			double last = 0;
+			sor::vector<double, n> x{};
+			auto const result = sor::conjugate_gradient_solve(a, b, x, limits, workspace, [&](std::size_t iteration, double value) {
+				++calls;
+				REQUIRE(iteration == calls);
+				last = value;
+				return iteration < 5;
+			});
+			REQUIRE(!result.converged);
+			REQUIRE(result.iterations == 5);
+			REQUIRE(calls == 5);
+			REQUIRE(last == result.residual);
+
+		}
+
+		THEN("a reused workspace isn't reallocated") {
+
+			sor::vector<double, n> x{};
+			sor::bicgstab_solve(a, b, x, limits, workspace);
+			double const* const vectors = workspace.vectors.data();
+			x = sor::vector<double, n>{};
+			sor::conjugate_gradient_solve(a, b, x, limits, workspace);
+			REQUIRE(workspace.vectors.data() == vectors);
+
+		}
+
+	}
+
+	GIVEN("a nonsymmetric convection diffusion problem") {
+
+		auto const a = make_poisson(0.4);
+		sor::vector<double, n> b;
+		for (std::size_t i = 0; i < n; ++i) { b[i] = std::cos(double(i)); }
+		sor::iteration_limits<double> limits;
+		limits.tolerance = 1e-9;
+		sor::iterative_workspace<double> workspace;
+
+		THEN("BiCGSTAB converges") {
+
+			sor::vector<double, n> x{};
+			auto const result = sor::bicgstab_solve(a, b, x, limits, workspace);
+			REQUIRE(result.converged);
+			REQUIRE(residual(a, b, x) < 1e-8);
+
+		}
+
+	}
+
+}
\ No newline at end of file
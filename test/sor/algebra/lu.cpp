@@ -0,0 +1,155 @@
+#include <cmath>
+#include <cstddef>
+
+#include "../../../deps/catch/include/catch.hpp"
+#include "../../../include/vector.hpp"
+#include "../../../include/matrix.hpp"
+#include "../../../include/algebra/matrix.hpp"
+#include "../../../include/algebra/lu.hpp"
+
+SCENARIO("LU decomposition of small matrices", "[algebra]") {
+
+	GIVEN("a 3 x 3 matrix that needs pivoting") {
+
+		sor::matrix<double, 3, 3> a({
+			0, 2, 1,
+			1, 1, 1,
+			2, 1, 3
+		});
+
+		WHEN("we decompose it") {
+
+			auto lu = sor::lu_decompose(a);
+
+			THEN("the permuted matrix is the product of the factors") {
+
+				REQUIRE(!lu.singular);
+				for (std::size_t i = 0; i < 3; ++i) {
+					for (std::size_t j = 0; j < 3; ++j) {
+						double sum = 0;
+						for (std::size_t k = 0; k <= i && k <= j; ++k) {
+							sum += (k == i ? 1.0 : lu.lu(i, k)) * lu.lu(k, j);
+						}
+						REQUIRE(sum == Approx(a(lu.permutation[i], j)));
+					}
+				}
+
+			}
+
+		}
+
+		WHEN("we solve a system") {
+
+			auto x = sor::solve(a, sor::vector<double, 3>({ 7, 6, 13 }));
+
+			THEN("we get its solution") {
+
+				REQUIRE(x[0] == Approx(1));
+				REQUIRE(x[1] == Approx(2));
+				REQUIRE(x[2] == Approx(3));
+
+			}
+
+		}
+
+		WHEN("we compute the determinant and the inverse") {
+
+			auto det = sor::determinant(a);
+			auto inv = sor::inverse(a);
+			auto product = a * inv;
+
+			THEN("they match the explicit formula and the identity") {
+
+				REQUIRE(det == Approx(-3));
+				REQUIRE(sor::determinant(sor::lu_decompose(a)) == Approx(-3));
+				for (std::size_t i = 0; i < 3; ++i) {
+					for (std::size_t j = 0; j < 3; ++j) {
+						REQUIRE(std::abs(product(i, j) - (i == j ? 1 : 0)) < 1e-12);
+					}
+				}
+
+			}
+
+		}
+
+	}
+
+	GIVEN("a singular matrix") {
+
+		sor::matrix<double, 4, 4> a({
+			1, 2, 3, 4,
+			2, 4, 6, 8,
+			0, 1, 0, 1,
+			1, 0, 1, 0
+		});
+
+		WHEN("we decompose it") {
+
+			auto lu = sor::lu_decompose(a);
+
+			THEN("it is flagged as singular and its determinant is zero") {
+
+				REQUIRE(lu.singular);
+				REQUIRE(sor::determinant(lu) == 0);
+				REQUIRE(sor::determinant(a) == 0);
+
+			}
+
+		}
+
+	}
+
+}
+
+SCENARIO("LU decomposition of large matrices", "[algebra]") {
+
+	GIVEN("a matrix spanning several panels") {
+
+		constexpr std::size_t n = 101;
+		static sor::matrix<double, n, n> a;
+		static sor::matrix<double, n, 3> b;
+		for (std::size_t i = 0; i < n; ++i) {
+			for (std::size_t j = 0; j < n; ++j) {
+				a(i, j) = std::sin(double(i * n + j)) + (i == (j * 7) % n ? n : 0);
+			}
+			for (std::size_t j = 0; j < 3; ++j) {
+				b(i, j) = std::cos(double(i + j));
+			}
+		}
+
+		WHEN("we solve a system with several right hand sides") {
+
+			auto x = sor::solve(a, b);
+			auto residual = a * x;
+
+			THEN("the solution satisfies every equation") {
+
+				for (std::size_t i = 0; i < n; ++i) {
+					for (std::size_t j = 0; j < 3; ++j) {
+						REQUIRE(std::abs(residual(i, j) - b(i, j)) < 1e-9);
+					}
+				}
+
+			}
+
+		}
+
+		WHEN("we invert it") {
+
+			auto product = sor::inverse(a) * a;
+
+			THEN("the product with the matrix is the identity") {
+
+				for (std::size_t i = 0; i < n; ++i) {
+					for (std::size_t j = 0; j < n; ++j) {
+						REQUIRE(std::abs(product(i, j) - (i == j ? 1 : 0)) < 1e-9);
+					}
+				}
+
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
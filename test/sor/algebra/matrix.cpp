@@ -1,6 +1,10 @@
+#include <cstdint>
+
 #include "../../../deps/catch/include/catch.hpp"
+#include "../../../include/vector.hpp"
 #include "../../../include/matrix.hpp"
 #include "../../../include/algebra/matrix.hpp"
+#include "../../../include/float16.hpp"
 
 SCENARIO("matrix multiplication", "[matrix]") {
 
@@ -46,4 +50,205 @@ SCENARIO("matrix multiplication", "[matrix]") {
 
 	}
 
+}
+
+SCENARIO("large matrix multiplication", "[matrix]") {
+
+	GIVEN("two matrices larger than the cache blocks") {
+
+		static sor::matrix<long, 7, 300> matrix1;
+		static sor::matrix<long, 300, 261> matrix2;
+		for (std::size_t i = 0; i < matrix1.size(); ++i) { matrix1.data()[i] = (i * 31) % 17 - 8; }
+		for (std::size_t i = 0; i < matrix2.size(); ++i) { matrix2.data()[i] = (i * 13) % 11 - 5; }
+
+		WHEN("we multiply them") {
+
+			auto result = matrix1 * matrix2;
+
+			THEN("the result is the matrix product") {
+
+				bool all_equal = true;
+				for (std::size_t m = 0; m < 7; ++m) {
+					for (std::size_t p = 0; p < 261; ++p) {
+						long expected = 0;
+						for (std::size_t n = 0; n < 300; ++n) {
+							expected += matrix1(m, n) * matrix2(n, p);
+						}
+						all_equal = all_equal && result(m, p) == expected;
+					}
+				}
+				REQUIRE(all_equal);
+
+			}
+
+		}
+
+	}
+
+}
+
+SCENARIO("outer product", "[matrix]") {
+
+	GIVEN("two vectors") {
+
+		sor::vector<int, 2> vector1({ 2, -1 });
+		sor::vector<long, 3> vector2({ 1, 3, 5 });
+
+		WHEN("we calculate their outer product") {
+
+			auto result = sor::outer_product(vector1, vector2);
+
+			THEN("the result is the matrix of the products of their elements") {
+
+				sor::matrix<long, 2, 3> expected({
+					2, 6, 10,
+					-1, -3, -5
+				});
+				REQUIRE(result == expected);
+
+			}
+
+		}
+
+	}
+
+}
+
+SCENARIO("kronecker product", "[matrix]") {
+
+	GIVEN("two matrices") {
+
+		sor::matrix<int, 2, 2> matrix1({
+			1, 2,
+			3, 4
+		});
+
+		sor::matrix<int, 2, 3> matrix2({
+			0, 5, 1,
+			6, 7, -1
+		});
+
+		WHEN("we calculate their kronecker product") {
+
+			auto result = sor::kronecker(matrix1, matrix2);
+
+			THEN("each element of the first scales a block equal to the second") {
+
+				sor::matrix<int, 4, 6> expected({
+					0, 5, 1, 0, 10, 2,
+					6, 7, -1, 12, 14, -2,
+					0, 15, 3, 0, 20, 4,
+					18, 21, -3, 24, 28, -4
+				});
+				REQUIRE(result == expected);
+
+			}
+
+		}
+
+	}
+
+}
+
+SCENARIO("rank one update", "[matrix]") {
+
+	GIVEN("a large matrix and two vectors") {
+
+		static sor::matrix<double, 300, 211> matrix;
+		sor::vector<double, 300> x;
+		sor::vector<double, 211> y;
+		for (std::size_t i = 0; i < matrix.size(); ++i) { matrix.data()[i] = double((i * 7) % 13) - 6; }
+		for (std::size_t i = 0; i < 300; ++i) { x[i] = double(i % 5) - 2; }
+		for (std::size_t j = 0; j < 211; ++j) { y[j] = double(j % 9) * 0.5; }
+		auto const original = matrix;
+
+		WHEN("we add a multiple of their outer product") {
+
+			sor::rank_one_update(matrix, 3.0, x, y);
+
+			THEN("the result is the same as forming the outer product") {
+
+				auto expected = sor::outer_product(x, y);
+				bool all_equal = true;
+				for (std::size_t i = 0; i < 300; ++i) {
+					for (std::size_t j = 0; j < 211; ++j) {
+						all_equal = all_equal && matrix(i, j) == original(i, j) + 3.0 * expected(i, j);
+					}
+				}
+				REQUIRE(all_equal);
+
+			}
+
+		}
+
+	}
+
+}
+
+SCENARIO("half precision matrix multiplication", "[matrix]") {
+
+	GIVEN("two half precision matrices with a long inner dimension") {
+
+		static sor::matrix<sor::float16, 2, 3000> matrix1;
+		static sor::matrix<sor::bfloat16, 3000, 2> matrix2;
+		for (std::size_t i = 0; i < matrix1.size(); ++i) { matrix1.data()[i] = 1.0f; }
+		static sor::matrix<sor::float16, 3000, 1> column;
+		for (std::size_t i = 0; i < matrix2.size(); ++i) { matrix2.data()[i] = i % 2 == 0 ? 1.0f : 0.5f; }
+		for (std::size_t i = 0; i < column.size(); ++i) { column.data()[i] = 1.0f; }
+
+		WHEN("we multiply them") {
+
+			auto result = matrix1 * matrix2;
+			auto narrow = matrix1 * column;
+
+			THEN("the products are accumulated in float") {
+
+				REQUIRE(result(0, 0) == 3000);
+				REQUIRE(result(1, 1) == 1500);
+				REQUIRE(narrow(1, 0) == 3000);
+
+			}
+
+			THEN("the result has the common type of the elements") {
+
+				constexpr bool is_float = std::is_same<decltype(result)::value_type, float>::value;
+				constexpr bool is_half = std::is_same<decltype(narrow)::value_type, sor::float16>::value;
+				REQUIRE(is_float);
+				REQUIRE(is_half);
+
+			}
+
+		}
+
+	}
+
+}
+
+SCENARIO("8 bit integer matrix multiplication", "[matrix]") {
+
+	GIVEN("two 8 bit matrices with odd extents") {
+
+		sor::matrix<std::int8_t, 7, 131> matrix1;
+		sor::matrix<std::int8_t, 131, 5> matrix2;
+		sor::matrix<int, 7, 131> wide1;
+		sor::matrix<int, 131, 5> wide2;
+		for (std::size_t i = 0; i < matrix1.size(); ++i) { wide1.data()[i] = matrix1.data()[i] = std::int8_t(i * 37 % 256 - 128); }
+		for (std::size_t i = 0; i < matrix2.size(); ++i) { wide2.data()[i] = matrix2.data()[i] = std::int8_t(i * 91 % 256 - 128); }
+
+		WHEN("we multiply them") {
+
+			auto result = matrix1 * matrix2;
+
+			THEN("the result is an exact matrix of int") {
+
+				constexpr bool is_int = std::is_same<decltype(result)::value_type, int>::value;
+				REQUIRE(is_int);
+				REQUIRE((result == wide1 * wide2));
+
+			}
+
+		}
+
+	}
+
 }
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include <cmath>
+#include <cstddef>
+
+#include "../../../deps/catch/include/catch.hpp"
+#include "../../../include/vector.hpp"
+#include "../../../include/matrix.hpp"
+#include "../../../include/packed_matrix.hpp"
+#include "../../../include/algebra/matrix.hpp"
+#include "../../../include/algebra/packed_matrix.hpp"
+
+namespace {
+
+	/* Fills the stored elements of a packed matrix, keeping its diagonal dominant.
+	*/
+	template<typename Packed>
+	Packed make_packed(std::size_t n) {
+		Packed result;
+		for (std::size_t i = 0; i < n; ++i) {
+			for (std::size_t j = 0; j < n; ++j) {
+				if (result.stored(i, j)) { result(i, j) = i == j ? double(n) : std::sin(double(i * n + j)); }
+			}
+		}
+		return result;
+	}
+
+}
+
+SCENARIO("packed matrix kernels", "[algebra]") {
+
+	GIVEN("packed matrices and dense operands") {
+
+		constexpr std::size_t n = 13;
+		auto symmetric = make_packed<sor::symmetric_matrix<double, n>>(n);
+		auto lower = make_packed<sor::lower_triangular<double, n>>(n);
+		auto upper = make_packed<sor::upper_triangular<double, n>>(n);
+		auto diagonal = make_packed<sor::diagonal_matrix<double, n>>(n);
+
+		sor::vector<double, n> x;
+		sor::matrix<double, n, 3> b;
+		for (std::size_t i = 0; i < n; ++i) {
+			x[i] = std::cos(double(i));
+			for (std::size_t j = 0; j < 3; ++j) { b(i, j) = std::cos(double(i * 3 + j)); }
+		}
+
+		THEN("products match the dense ones") {
+
+			auto check = [&](auto const& packed) {
+				auto const dense = sor::materialize(packed);
+				auto const y = packed * x;
+				auto const c = packed * b;
+				auto const expected = dense * b;
+				for (std::size_t i = 0; i < n; ++i) {
+					double sum = 0;
+					for (std::size_t j = 0; j < n; ++j) { sum += dense(i, j) * x[j]; }
+					REQUIRE(y[i] == Approx(sum));
+					for (std::size_t j = 0; j < 3; ++j) { REQUIRE(c(i, j) == Approx(expected(i, j))); }
+				}
+			};
+			check(symmetric);
+			check(lower);
+			check(upper);
+			check(diagonal);
+
+		}
+
+		THEN("products of matrices with the same structure keep it") {
+
+			auto const lower_product = sor::materialize(lower * lower);
+			auto const upper_product = sor::materialize(upper * upper);
+			auto const diagonal_product = sor::materialize(diagonal * diagonal);
+			auto const lower_expected = sor::materialize(lower) * sor::materialize(lower);
+			auto const upper_expected = sor::materialize(upper) * sor::materialize(upper);
+			auto const diagonal_expected = sor::materialize(diagonal) * sor::materialize(diagonal);
+			for (std::size_t i = 0; i < n; ++i) {
+				for (std::size_t j = 0; j < n; ++j) {
+					REQUIRE(lower_product(i, j) == Approx(lower_expected(i, j)));
+					REQUIRE(upper_product(i, j) == Approx(upper_expected(i, j)));
+					REQUIRE(diagonal_product(i, j) == Approx(diagonal_expected(i, j)));
+				}
+			}
+
+		}
+
+		THEN("systems are solved") {
+
+			auto check = [&](auto const& packed) {
+				auto const dense = sor::materialize(packed);
+				auto const solution = sor::solve(packed, x);
+				auto const solutions = sor::solve(packed, b);
+				auto const residual = dense * solutions;
+				for (std::size_t i = 0; i < n; ++i) {
+					double sum = 0;
+					for (std::size_t j = 0; j < n; ++j) { sum += dense(i, j) * solution[j]; }
+					REQUIRE(std::abs(sum - x[i]) < 1e-12);
+					for (std::size_t j = 0; j < 3; ++j) { REQUIRE(std::abs(residual(i, j) - b(i, j)) < 1e-12); }
+				}
+			};
+			check(symmetric);
+			check(lower);
+			check(upper);
+			check(diagonal);
+
+		}
+
+		THEN("symmetric systems that aren't positive definite are reported") {
+
+			auto indefinite = symmetric;
+			indefinite(0, 0) = -1.0;
+			auto in_place = x;
+			auto const solution = sor::solve(indefinite, x);
+			REQUIRE_FALSE(sor::solve_in_place(indefinite, in_place));
+			for (std::size_t i = 0; i < n; ++i) {
+				REQUIRE(in_place[i] == x[i]);
+				REQUIRE(std::isnan(solution[i]));
+			}
+			REQUIRE(sor::solve_in_place(symmetric, in_place));
+
+		}
+
+	}
+
+}
\ No newline at end of file
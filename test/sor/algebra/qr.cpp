@@ -0,0 +1,127 @@
+#include <cmath>
+#include <cstddef>
+
+#include "../../../deps/catch/include/catch.hpp"
+#include "../../../include/vector.hpp"
+#include "../../../include/matrix.hpp"
+#include "../../../include/algebra/matrix.hpp"
+#include "../../../include/algebra/qr.hpp"
+
+SCENARIO("QR decomposition", "[algebra]") {
+
+	GIVEN("a matrix spanning several panels") {
+
+		constexpr std::size_t m = 70, n = 45;
+		static sor::matrix<double, m, n> a;
+		for (std::size_t i = 0; i < m; ++i) {
+			for (std::size_t j = 0; j < n; ++j) {
+				a(i, j) = std::sin(double(i * n + j) * 0.7);
+			}
+		}
+
+		WHEN("we decompose it") {
+
+			auto qr = sor::qr_decompose(a);
+			auto q = sor::q_factor(qr);
+			auto r = sor::r_factor(qr);
+			auto product = q * r;
+
+			THEN("the product of the factors is the matrix") {
+
+				for (std::size_t i = 0; i < m; ++i) {
+					for (std::size_t j = 0; j < n; ++j) {
+						REQUIRE(std::abs(product(i, j) - a(i, j)) < 1e-10);
+					}
+				}
+
+			}
+
+			THEN("the columns of the orthogonal factor are orthonormal") {
+
+				for (std::size_t i = 0; i < n; ++i) {
+					for (std::size_t j = 0; j < n; ++j) {
+						double sum = 0;
+						for (std::size_t k = 0; k < m; ++k) { sum += q(k, i) * q(k, j); }
+						REQUIRE(std::abs(sum - (i == j ? 1 : 0)) < 1e-10);
+					}
+				}
+
+			}
+
+		}
+
+	}
+
+}
+
+SCENARIO("least squares", "[algebra]") {
+
+	GIVEN("an overdetermined system") {
+
+		sor::matrix<double, 4, 2> a({
+			1, 0,
+			1, 1,
+			1, 2,
+			1, 3
+		});
+		sor::vector<double, 4> b({ 1, 2, 2, 4 });
+
+		WHEN("we solve it in the least squares sense") {
+
+			auto x = sor::least_squares(a, b);
+
+			THEN("we get the line of best fit") {
+
+				REQUIRE(x[0] == Approx(0.9));
+				REQUIRE(x[1] == Approx(0.9));
+
+			}
+
+		}
+
+	}
+
+	GIVEN("a tall and skinny system") {
+
+		constexpr std::size_t m = 2000, n = 4;
+		static sor::matrix<double, m, n> a;
+		static sor::matrix<double, m, 2> b;
+		for (std::size_t i = 0; i < m; ++i) {
+			double const t = double(i) / m;
+			for (std::size_t j = 0; j < n; ++j) { a(i, j) = std::pow(t, double(j)); }
+			b(i, 0) = 1 - 2 * t + 3 * t * t * t;
+			b(i, 1) = std::cos(double(i));
+		}
+
+		WHEN("we solve it in the least squares sense") {
+
+			auto x = sor::least_squares(a, b);
+
+			THEN("consistent equations are solved exactly") {
+
+				REQUIRE(std::abs(x(0, 0) - 1) < 1e-9);
+				REQUIRE(std::abs(x(1, 0) + 2) < 1e-9);
+				REQUIRE(std::abs(x(2, 0)) < 1e-9);
+				REQUIRE(std::abs(x(3, 0) - 3) < 1e-9);
+
+			}
+
+			THEN("the residual of the others is orthogonal to the columns") {
+
+				for (std::size_t j = 0; j < n; ++j) {
+					double sum = 0;
+					for (std::size_t i = 0; i < m; ++i) {
+						double residual = -b(i, 1);
+						for (std::size_t k = 0; k < n; ++k) { residual += a(i, k) * x(k, 1); }
+						sum += a(i, j) * residual;
+					}
+					REQUIRE(std::abs(sum) < 1e-9);
+				}
+
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,164 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "../../../deps/catch/include/catch.hpp"
+#include "../../../include/tensor.hpp"
+#include "../../../include/vector.hpp"
+#include "../../../include/matrix.hpp"
+#include "../../../include/quantized_tensor.hpp"
+#include "../../../include/algebra/matrix.hpp"
+#include "../../../include/algebra/quantized.hpp"
+
+SCENARIO("quantization", "[quantized]") {
+
+	GIVEN("a vector") {
+
+		sor::vector<float, 4> v({ -1.28f, 0.0f, 0.5f, 1.27f });
+
+		WHEN("we quantize it per tensor") {
+
+			auto q = sor::quantize<sor::quantization::per_tensor>(v);
+
+			THEN("its range is mapped onto the 8 bit integers") {
+
+				REQUIRE(q.scales[0] == Approx(0.01f));
+				REQUIRE(q.values[0] == -128);
+				REQUIRE(q.values[2] == 50);
+				REQUIRE(q.values[3] == 127);
+
+			}
+
+			THEN("zero is represented exactly") {
+
+				REQUIRE(q.values[1] == q.zero_points[0]);
+				REQUIRE(sor::dequantize(q)[1] == 0);
+
+			}
+
+			THEN("dequantizing gives the elements within half a scale") {
+
+				auto result = sor::dequantize(q);
+				for (std::size_t i = 0; i < 4; ++i) {
+					REQUIRE(std::abs(result[i] - v[i]) <= q.scales[0] / 2 * 1.001f);
+				}
+
+			}
+
+		}
+
+	}
+
+	GIVEN("a vector of positive elements") {
+
+		sor::vector<float, 3> v({ 2.0f, 3.0f, 5.1f });
+
+		WHEN("we quantize it") {
+
+			auto q = sor::quantize<sor::quantization::per_tensor>(v);
+
+			THEN("the range is widened to include zero") {
+
+				REQUIRE(q.zero_points[0] == -128);
+				REQUIRE(q.values[2] == 127);
+				REQUIRE(sor::dequantize(q)[2] == Approx(5.1f));
+
+			}
+
+		}
+
+	}
+
+	GIVEN("a matrix of zeros") {
+
+		sor::matrix<float, 2, 2> m{};
+
+		WHEN("we quantize it") {
+
+			auto q = sor::quantize<sor::quantization::per_tensor>(m);
+
+			THEN("it dequantizes to zeros") {
+
+				REQUIRE((sor::dequantize(q) == m));
+
+			}
+
+		}
+
+	}
+
+	GIVEN("a matrix whose rows have very different ranges") {
+
+		sor::matrix<float, 2, 3> m({
+			0.01f, -0.02f, 0.005f,
+			100.0f, -50.0f, 25.0f
+		});
+
+		WHEN("we quantize it per row") {
+
+			auto q = sor::quantize<sor::quantization::per_row>(m);
+			auto result = sor::dequantize(q);
+
+			THEN("each row is represented within half of its own scale") {
+
+				REQUIRE(q.scales[0] < q.scales[1]);
+				for (std::size_t i = 0; i < 2; ++i) {
+					for (std::size_t j = 0; j < 3; ++j) {
+						REQUIRE(std::abs(result(i, j) - m(i, j)) <= q.scales[i] / 2 * 1.001f);
+					}
+				}
+
+			}
+
+		}
+
+	}
+
+}
+
+SCENARIO("quantized matrix multiplication", "[quantized]") {
+
+	GIVEN("two quantized matrices with odd extents") {
+
+		static sor::matrix<float, 9, 150> lhs;
+		static sor::matrix<float, 150, 11> rhs;
+		for (std::size_t i = 0; i < lhs.size(); ++i) { lhs.data()[i] = std::sin(float(i)) * (1 + float(i / 150)); }
+		for (std::size_t i = 0; i < rhs.size(); ++i) { rhs.data()[i] = std::cos(float(i)) * 0.5f + 0.25f; }
+		auto q_rhs = sor::quantize<sor::quantization::per_tensor>(rhs);
+
+		WHEN("we multiply them") {
+
+			auto per_tensor = sor::quantize<sor::quantization::per_tensor>(lhs);
+			auto per_row = sor::quantize<sor::quantization::per_row>(lhs);
+			auto result = sor::quantized_multiply(per_tensor, q_rhs);
+			auto row_result = sor::quantized_multiply(per_row, q_rhs);
+
+			THEN("the result is the product of the dequantized matrices") {
+
+				auto expected = sor::dequantize(per_tensor) * sor::dequantize(q_rhs);
+				auto row_expected = sor::dequantize(per_row) * sor::dequantize(q_rhs);
+				for (std::size_t i = 0; i < 9; ++i) {
+					for (std::size_t j = 0; j < 11; ++j) {
+						REQUIRE(std::abs(result(i, j) - expected(i, j)) < 1e-3f);
+						REQUIRE(std::abs(row_result(i, j) - row_expected(i, j)) < 1e-3f);
+					}
+				}
+
+			}
+
+			THEN("it approximates the product of the original matrices") {
+
+				auto exact = lhs * rhs;
+				for (std::size_t i = 0; i < 9; ++i) {
+					for (std::size_t j = 0; j < 11; ++j) {
+						REQUIRE(std::abs(row_result(i, j) - exact(i, j)) < 0.2f * (1 + i));
+					}
+				}
+
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
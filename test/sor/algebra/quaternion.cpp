@@ -0,0 +1,219 @@
+#include <cmath>
+#include <cstddef>
+
+#include "../../../deps/catch/include/catch.hpp"
+#include "../../../include/vector.hpp"
+#include "../../../include/matrix.hpp"
+#include "../../../include/quaternion.hpp"
+#include "../../../include/algebra/matrix.hpp"
+#include "../../../include/algebra/quaternion.hpp"
+
+namespace {
+
+	template<std::size_t N>
+	double distance(sor::vector<double, N> const& lhs, sor::vector<double, N> const& rhs) {
+		double result = 0;
+		for (std::size_t i = 0; i < N; ++i) { result = std::max(result, std::abs(lhs[i] - rhs[i])); }
+		return result;
+	}
+
+	/* Distance between the rotations of two unit quaternions, which `q` and `-q` share.
+	*/
+	double rotation_distance(sor::quaternion<double> const& lhs, sor::quaternion<double> const& rhs) {
+		return 1 - std::abs(sor::dot_product(lhs.components(), rhs.components()));
+	}
+
+}
+
+SCENARIO("quaternion algebra", "[quaternion]") {
+
+	GIVEN("two quaternions") {
+
+		constexpr sor::quaternion<int> lhs(1, 2, 3, 4);
+		constexpr sor::quaternion<long> rhs(5, 6, 7, 8);
+
+		WHEN("we multiply them") {
+
+			constexpr auto result = lhs * rhs;
+
+			THEN("the result is the Hamilton product") {
+
+				static_assert(result == sor::quaternion<long>(24, 48, 48, -6), "the Hamilton product is a constant expression");
+				REQUIRE((rhs * lhs == sor::quaternion<long>(32, 32, 56, -6)));
+
+			}
+
+		}
+
+		THEN("the product by the inverse is the identity") {
+
+			sor::quaternion<double> q(1, 2, 3, 4);
+			REQUIRE(rotation_distance(q * sor::inverse(q), sor::quaternion<double>()) < 1e-15);
+			REQUIRE(std::abs(sor::norm(q) - std::sqrt(30.0)) < 1e-15);
+			sor::normalize(q);
+			REQUIRE(std::abs(sor::norm(q) - 1) < 1e-15);
+			REQUIRE(rotation_distance(sor::inverse(q), sor::conjugate(q)) < 1e-15);
+
+		}
+
+	}
+
+}
+
+SCENARIO("rotations", "[quaternion]") {
+
+	GIVEN("a quarter turn around the z axis") {
+
+		auto q = sor::from_axis_angle(sor::vector<double, 3>({ 0, 0, 1 }), std::acos(-1.0) / 2);
+
+		THEN("it rotates x onto y") {
+
+			REQUIRE(distance(sor::rotate(q, sor::vector<double, 3>({ 1, 0, 0 })), sor::vector<double, 3>({ 0, 1, 0 })) < 1e-15);
+			REQUIRE(distance(sor::rotate(q, sor::vector<double, 3>({ 0.0, 1.0, 2.0 })), sor::vector<double, 3>({ -1.0, 0.0, 2.0 })) < 1e-15);
+
+		}
+
+		THEN("composing it twice gives a half turn") {
+
+			auto half = sor::from_axis_angle(sor::vector<double, 3>({ 0, 0, 1 }), std::acos(-1.0));
+			REQUIRE(rotation_distance(q * q, half) < 1e-15);
+
+		}
+
+	}
+
+	GIVEN("arbitrary rotations") {
+
+		sor::quaternion<double> rotations[] = {
+			sor::from_axis_angle(sor::vector<double, 3>({ 0.6, 0.0, 0.8 }), 0.3),
+			sor::from_axis_angle(sor::vector<double, 3>({ 0, 1, 0 }), 3.1),
+			sor::from_axis_angle(sor::vector<double, 3>({ 1, 0, 0 }), -2.9),
+			sor::from_axis_angle(sor::vector<double, 3>({ 0.0, 0.28, 0.96 }), 3.0),
+			sor::quaternion<double>(0.5, -0.5, 0.5, 0.5)
+		};
+		sor::vector<double, 3> v({ 0.3, -1.2, 2.5 });
+
+		THEN("rotating by the matrix is the same as rotating by the quaternion") {
+
+			for (auto const& q : rotations) {
+				sor::matrix<double, 3, 3> m = sor::to_rotation_matrix(q);
+				sor::vector<double, 3> expected{};
+				for (std::size_t i = 0; i < 3; ++i) {
+					for (std::size_t j = 0; j < 3; ++j) { expected[i] += m(i, j) * v[j]; }
+				}
+				REQUIRE(distance(sor::rotate(q, v), expected) < 1e-14);
+			}
+
+		}
+
+		THEN("the matrix converts back to the same rotation") {
+
+			for (auto const& q : rotations) {
+				REQUIRE(rotation_distance(sor::from_rotation_matrix(sor::to_rotation_matrix(q)), q) < 1e-15);
+			}
+
+		}
+
+		THEN("composing quaternions is the same as multiplying their matrices") {
+
+			auto product = sor::to_rotation_matrix(rotations[0]) * sor::to_rotation_matrix(rotations[1]);
+			auto composed = sor::to_rotation_matrix(rotations[0] * rotations[1]);
+			for (std::size_t i = 0; i < 3; ++i) {
+				for (std::size_t j = 0; j < 3; ++j) { REQUIRE(std::abs(product(i, j) - composed(i, j)) < 1e-15); }
+			}
+
+		}
+
+	}
+
+}
+
+SCENARIO("spherical linear interpolation", "[quaternion]") {
+
+	GIVEN("two rotations around the same axis") {
+
+		sor::vector<double, 3> axis({ 0.0, 0.6, 0.8 });
+		auto from = sor::from_axis_angle(axis, 0.2);
+		auto to = sor::from_axis_angle(axis, 1.4);
+
+		THEN("interpolating gives the rotations in between") {
+
+			REQUIRE(rotation_distance(sor::slerp(from, to, 0.0), from) < 1e-15);
+			REQUIRE(rotation_distance(sor::slerp(from, to, 1.0), to) < 1e-15);
+			REQUIRE(rotation_distance(sor::slerp(from, to, 0.25), sor::from_axis_angle(axis, 0.5)) < 1e-15);
+
+		}
+
+		THEN("the shorter arc is taken when the quaternions have opposite signs") {
+
+			sor::quaternion<double> opposite(-to.x(), -to.y(), -to.z(), -to.w());
+			REQUIRE(rotation_distance(sor::slerp(from, opposite, 0.5), sor::from_axis_angle(axis, 0.8)) < 1e-15);
+
+		}
+
+		THEN("nearly equal rotations are interpolated linearly") {
+
+			auto close = sor::from_axis_angle(axis, 0.2001);
+			REQUIRE(rotation_distance(sor::slerp(from, close, 0.5), sor::from_axis_angle(axis, 0.20005)) < 1e-15);
+
+		}
+
+	}
+
+}
+
+SCENARIO("rigid transforms", "[quaternion]") {
+
+	GIVEN("two poses") {
+
+		sor::rigid_transform<double> first{
+			sor::from_axis_angle(sor::vector<double, 3>({ 0, 0, 1 }), 0.7), sor::vector<double, 3>({ 1.0, -2.0, 0.5 })
+		};
+		sor::rigid_transform<double> second{
+			sor::from_axis_angle(sor::vector<double, 3>({ 0.6, 0.8, 0.0 }), -1.1), sor::vector<double, 3>({ 0, 3, -1 })
+		};
+		sor::vector<double, 3> point({ 2.0, 0.5, -1.5 });
+
+		THEN("composing them is the same as applying them in turn") {
+
+			auto composed = sor::transform_point(first * second, point);
+			auto sequential = sor::transform_point(first, sor::transform_point(second, point));
+			REQUIRE(distance(composed, sequential) < 1e-14);
+
+		}
+
+		THEN("the inverse undoes the transform") {
+
+			auto back = sor::transform_point(sor::inverse(first), sor::transform_point(first, point));
+			REQUIRE(distance(back, point) < 1e-14);
+
+		}
+
+		WHEN("a point cloud is transformed") {
+
+			constexpr std::size_t N = 1000;
+			static sor::matrix<double, 3, N> cloud;
+			for (std::size_t j = 0; j < N; ++j) {
+				cloud(0, j) = std::sin(0.1 * j);
+				cloud(1, j) = std::cos(0.3 * j);
+				cloud(2, j) = 0.01 * j;
+			}
+			auto result = sor::transform_points(first, cloud);
+
+			THEN("each point is transformed as on its own") {
+
+				double error = 0;
+				for (std::size_t j = 0; j < N; ++j) {
+					auto expected = sor::transform_point(first, sor::vector<double, 3>({ cloud(0, j), cloud(1, j), cloud(2, j) }));
+					auto actual = sor::vector<double, 3>({ result(0, j), result(1, j), result(2, j) });
+					error = std::max(error, distance(actual, expected));
+				}
+				REQUIRE(error < 1e-14);
+
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
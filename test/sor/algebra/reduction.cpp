@@ -0,0 +1,181 @@
+#include <type_traits>
+
+#include "../../../deps/catch/include/catch.hpp"
+#include "../../../include/tensor.hpp"
+#include "../../../include/vector.hpp"
+#include "../../../include/matrix.hpp"
+#include "../../../include/float16.hpp"
+#include "../../../include/algebra/reduction.hpp"
+
+SCENARIO("matrix reductions", "[algebra]") {
+
+	GIVEN("a matrix") {
+
+		sor::matrix<int, 2, 3> matrix({
+			1, 8, 3,
+			4, 5, 6
+		});
+
+		WHEN("we sum along each axis") {
+
+			auto columns = sor::sum<0>(matrix);
+			auto rows = sor::sum<1>(matrix);
+
+			THEN("we get the sums of the columns and of the rows") {
+
+				REQUIRE((columns == sor::vector<int, 3>({ 5, 13, 9 })));
+				REQUIRE((rows == sor::vector<int, 2>({ 12, 15 })));
+
+			}
+
+		}
+
+		WHEN("we compute the mean along the rows") {
+
+			auto result = sor::mean<1>(matrix);
+
+			THEN("the result is a vector of doubles") {
+
+				constexpr bool is_double = std::is_same<
+					decltype(result),
+					sor::vector<double, 2>
+				>::value;
+				REQUIRE(is_double);
+				REQUIRE(result[0] == 4.0);
+				REQUIRE(result[1] == 5.0);
+
+			}
+
+		}
+
+		WHEN("we compute minimums and maximums") {
+
+			THEN("we get the extremes of each slice") {
+
+				REQUIRE((sor::min<0>(matrix) == sor::vector<int, 3>({ 1, 5, 3 })));
+				REQUIRE((sor::max<1>(matrix) == sor::vector<int, 2>({ 8, 6 })));
+				REQUIRE((sor::argmin<0>(matrix) == sor::vector<std::size_t, 3>({ 0, 1, 0 })));
+				REQUIRE((sor::argmax<1>(matrix) == sor::vector<std::size_t, 2>({ 1, 2 })));
+
+			}
+
+		}
+
+	}
+
+}
+
+SCENARIO("vector reductions", "[algebra]") {
+
+	GIVEN("a long vector") {
+
+		sor::vector<float, 37> vector;
+		for (std::size_t i = 0; i < vector.size(); ++i) {
+			vector[i] = static_cast<float>((i * 7) % 37);
+		}
+
+		WHEN("we reduce its only axis") {
+
+			THEN("we get scalars") {
+
+				REQUIRE(sor::sum<0>(vector) == 666.0f);
+				REQUIRE(sor::mean<0>(vector) == 18.0f);
+				REQUIRE(sor::min<0>(vector) == 0.0f);
+				REQUIRE(sor::max<0>(vector) == 36.0f);
+				REQUIRE(sor::argmin<0>(vector) == 0);
+				REQUIRE(sor::argmax<0>(vector) == 21);
+
+			}
+
+		}
+
+	}
+
+	GIVEN("a vector with repeated extremes") {
+
+		sor::vector<int, 20> vector;
+		for (std::size_t i = 0; i < vector.size(); ++i) {
+			vector[i] = (i % 5 == 3) ? 9 : 1;
+		}
+
+		WHEN("we search for the maximum") {
+
+			THEN("we get the position of the first one") {
+
+				REQUIRE(sor::argmax<0>(vector) == 3);
+				REQUIRE(sor::argmin<0>(vector) == 0);
+
+			}
+
+		}
+
+	}
+
+}
+
+SCENARIO("higher order tensor reductions", "[algebra]") {
+
+	GIVEN("an order 3 tensor") {
+
+		sor::tensor<int, 2, 3, 2> tensor({
+			1, 2,
+			3, 4,
+			5, 6,
+
+			7, 8,
+			9, 10,
+			11, 12
+		});
+
+		WHEN("we reduce the middle axis") {
+
+			auto sum = sor::sum<1>(tensor);
+			auto argmin = sor::argmin<1>(tensor);
+
+			THEN("we get a matrix with the reduced extent removed") {
+
+				REQUIRE((sum == sor::matrix<int, 2, 2>({ 9, 12, 27, 30 })));
+				REQUIRE((argmin == sor::matrix<std::size_t, 2, 2>({ 0, 0, 0, 0 })));
+
+			}
+
+		}
+
+		WHEN("we reduce the outermost and innermost axes") {
+
+			THEN("we get matrices with the reduced extent removed") {
+
+				REQUIRE((sor::max<0>(tensor) == sor::matrix<int, 3, 2>({ 7, 8, 9, 10, 11, 12 })));
+				REQUIRE((sor::sum<2>(tensor) == sor::matrix<int, 2, 3>({ 3, 7, 11, 15, 19, 23 })));
+
+			}
+
+		}
+
+	}
+
+}
+
+SCENARIO("half precision reductions", "[reduction]") {
+
+	GIVEN("a half precision matrix with long rows") {
+
+		static sor::matrix<sor::float16, 2, 5000> matrix;
+		for (std::size_t i = 0; i < matrix.size(); ++i) { matrix.data()[i] = 1.0f; }
+
+		THEN("sums and means are accumulated in float") {
+
+			auto rows = sor::sum<1>(matrix);
+			auto means = sor::mean<1>(matrix);
+			constexpr bool is_float = std::is_same<decltype(rows)::value_type, float>::value;
+			REQUIRE(is_float);
+			REQUIRE(rows[0] == 5000);
+			REQUIRE(rows[1] == 5000);
+			REQUIRE(means[0] == 1);
+			REQUIRE(float(sor::max<1>(matrix)[1]) == 1);
+
+		}
+
+	}
+
+}
\ No newline at end of file
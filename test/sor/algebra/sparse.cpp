@@ -0,0 +1,102 @@
+#include <cmath>
+#include <cstddef>
+
+#include "../../../deps/catch/include/catch.hpp"
+#include "../../../include/vector.hpp"
+#include "../../../include/matrix.hpp"
+#include "../../../include/sparse_matrix.hpp"
+#include "../../../include/algebra/matrix.hpp"
+#include "../../../include/algebra/sparse.hpp"
+
+SCENARIO("sparse matrix multiplication", "[algebra]") {
+
+	GIVEN("a small sparse matrix") {
+
+		sor::matrix<int, 3, 4> dense({
+			0, 3, 0, 0,
+			0, 0, 6, 0,
+			4, 0, 0, 5
+		});
+		sor::csr_matrix<int, 3, 4> csr(dense);
+		sor::csc_matrix<int, 3, 4> csc(dense);
+		sor::vector<int, 4> x({ 1, 2, 3, 4 });
+		sor::matrix<int, 4, 2> b({
+			1, 0,
+			0, 1,
+			2, 0,
+			0, 3
+		});
+
+		THEN("multiplying it by a vector gives the dense result") {
+
+			sor::vector<int, 3> expected({ 6, 18, 24 });
+			REQUIRE((csr * x == expected));
+			REQUIRE((csc * x == expected));
+
+		}
+
+		THEN("multiplying it by a matrix gives the dense result") {
+
+			sor::matrix<int, 3, 2> expected({
+				0, 3,
+				12, 0,
+				4, 15
+			});
+			REQUIRE((csr * b == expected));
+			REQUIRE((csc * b == expected));
+
+		}
+
+	}
+
+	GIVEN("a large sparse matrix with uneven rows") {
+
+		constexpr std::size_t n = 300;
+		sor::coo_matrix<double, n, n> coo;
+		for (std::size_t i = 0; i < n; ++i) {
+			std::size_t const stride = i < 10 ? 1 : 5;
+			for (std::size_t j = i % stride; j < n; j += stride) { coo.insert(i, j, std::sin(double(i * n + j))); }
+		}
+		sor::csr_matrix<double, n, n> csr(coo);
+		sor::csc_matrix<double, n, n> csc(coo);
+		auto const dense = sor::materialize(coo);
+
+		sor::vector<double, n> x;
+		sor::matrix<double, n, 3> b;
+		for (std::size_t i = 0; i < n; ++i) {
+			x[i] = std::cos(double(i));
+			for (std::size_t c = 0; c < 3; ++c) { b(i, c) = std::cos(double(i * 3 + c)); }
+		}
+
+		THEN("SpMV matches the dense product") {
+
+			sor::vector<double, n> expected{};
+			for (std::size_t i = 0; i < n; ++i) {
+				for (std::size_t j = 0; j < n; ++j) { expected[i] += dense(i, j) * x[j]; }
+			}
+			auto const from_rows = csr * x;
+			auto const from_columns = csc * x;
+			for (std::size_t i = 0; i < n; ++i) {
+				REQUIRE(std::abs(from_rows[i] - expected[i]) < 1e-9);
+				REQUIRE(std::abs(from_columns[i] - expected[i]) < 1e-9);
+			}
+
+		}
+
+		THEN("SpMM matches the dense product") {
+
+			auto const expected = dense * b;
+			auto const from_rows = csr * b;
+			auto const from_columns = csc * b;
+			for (std::size_t i = 0; i < n; ++i) {
+				for (std::size_t c = 0; c < 3; ++c) {
+					REQUIRE(std::abs(from_rows(i, c) - expected(i, c)) < 1e-9);
+					REQUIRE(std::abs(from_columns(i, c) - expected(i, c)) < 1e-9);
+				}
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
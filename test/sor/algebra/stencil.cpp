@@ -0,0 +1,162 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+#include "../../../deps/catch/include/catch.hpp"
+#include "../../../include/tensor.hpp"
+#include "../../../include/matrix.hpp"
+#include "../../../include/algebra/stencil.hpp"
+
+namespace {
+
+	/* Index read at position `i` of an axis of `n` elements, or -1 for zero.
+	*/
+	long reference_index(long i, long n, sor::boundary mode) {
+		if (i >= 0 && i < n) { return i; }
+		if (mode == sor::boundary::clamp) { return i < 0 ? 0 : n - 1; }
+		if (mode == sor::boundary::periodic) { return ((i % n) + n) % n; }
+		return -1;
+	}
+
+	/* One step of a three dimensional stencil, element by element.
+	*/
+	template<std::size_t D, std::size_t H, std::size_t W, std::size_t KD, std::size_t KH, std::size_t KW>
+	sor::tensor<double, D, H, W> reference(
+		sor::tensor<double, D, H, W> const& input, sor::tensor<double, KD, KH, KW> const& weights, sor::boundary mode
+	) {
+		sor::tensor<double, D, H, W> result{};
+		for (long d = 0; d < long(D); ++d) {
+			for (long h = 0; h < long(H); ++h) {
+				for (long w = 0; w < long(W); ++w) {
+					for (long a = 0; a < long(KD); ++a) {
+						for (long b = 0; b < long(KH); ++b) {
+							for (long c = 0; c < long(KW); ++c) {
+								long const sd = reference_index(d + a - long(KD / 2), long(D), mode);
+								long const sh = reference_index(h + b - long(KH / 2), long(H), mode);
+								long const sw = reference_index(w + c - long(KW / 2), long(W), mode);
+								if (sd < 0 || sh < 0 || sw < 0) { continue; }
+								result(d, h, w) += weights(a, b, c) * input(sd, sh, sw);
+							}
+						}
+					}
+				}
+			}
+		}
+		return result;
+	}
+
+	template<typename Tensor>
+	double distance(Tensor const& lhs, Tensor const& rhs) {
+		double result = 0;
+		for (std::size_t i = 0; i < lhs.size(); ++i) { result = std::max(result, std::abs(lhs.data()[i] - rhs.data()[i])); }
+		return result;
+	}
+
+}
+
+SCENARIO("stencils over two dimensional tensors", "[algebra]") {
+
+	GIVEN("a grid and the 5-point Laplacian") {
+
+		sor::matrix<double, 9, 11> grid;
+		for (std::size_t i = 0; i < grid.size(); ++i) { grid.data()[i] = std::sin(double(i)); }
+		sor::matrix<double, 3, 3> laplacian({
+			0, 1, 0,
+			1, -4, 1,
+			0, 1, 0
+		});
+
+		THEN("a step matches the element by element stencil for every boundary") {
+
+			for (auto mode : { sor::boundary::zero, sor::boundary::clamp, sor::boundary::periodic }) {
+				auto const result = sor::stencil_apply(grid, laplacian, mode);
+				for (long i = 0; i < 9; ++i) {
+					for (long j = 0; j < 11; ++j) {
+						double expected = -4 * grid(i, j);
+						for (auto offset : { std::make_pair(-1, 0), std::make_pair(1, 0), std::make_pair(0, -1), std::make_pair(0, 1) }) {
+							long const si = reference_index(i + offset.first, 9, mode);
+							long const sj = reference_index(j + offset.second, 11, mode);
+							if (si >= 0 && sj >= 0) { expected += grid(si, sj); }
+						}
+						REQUIRE(std::abs(result(i, j) - expected) < 1e-12);
+					}
+				}
+			}
+
+		}
+
+		THEN("repeated steps match repeated single steps") {
+
+			for (auto mode : { sor::boundary::zero, sor::boundary::clamp, sor::boundary::periodic }) {
+				for (std::size_t steps : { 0, 2, 5, 9 }) {
+					auto expected = grid;
+					for (std::size_t s = 0; s < steps; ++s) { expected = sor::stencil_apply(expected, laplacian, mode); }
+					REQUIRE(distance(sor::stencil_apply(grid, laplacian, mode, steps), expected) < 1e-9);
+				}
+			}
+
+		}
+
+	}
+
+	GIVEN("an asymmetric kernel") {
+
+		sor::matrix<double, 6, 7> image;
+		for (std::size_t i = 0; i < image.size(); ++i) { image.data()[i] = double(i % 5); }
+		sor::matrix<double, 3, 5> kernel;
+		for (std::size_t i = 0; i < kernel.size(); ++i) { kernel.data()[i] = double(i) - 7; }
+
+		THEN("convolution reverses the kernel") {
+
+			auto const result = sor::convolve(image, kernel, sor::boundary::clamp);
+			for (long i = 0; i < 6; ++i) {
+				for (long j = 0; j < 7; ++j) {
+					double expected = 0;
+					for (long a = 0; a < 3; ++a) {
+						for (long b = 0; b < 5; ++b) {
+							expected += kernel(a, b) * image(reference_index(i - a + 1, 6, sor::boundary::clamp), reference_index(j - b + 2, 7, sor::boundary::clamp));
+						}
+					}
+					REQUIRE(std::abs(result(i, j) - expected) < 1e-12);
+				}
+			}
+
+		}
+
+	}
+
+}
+
+SCENARIO("stencils over three dimensional tensors", "[algebra]") {
+
+	GIVEN("a volume and a 27-point stencil") {
+
+		sor::tensor<double, 7, 5, 6> volume;
+		for (std::size_t i = 0; i < volume.size(); ++i) { volume.data()[i] = std::cos(double(i)); }
+		sor::tensor<double, 3, 3, 3> weights;
+		for (std::size_t i = 0; i < weights.size(); ++i) { weights.data()[i] = 1.0 / 27 + double(i % 3) / 100; }
+
+		THEN("steps match the element by element stencil") {
+
+			for (auto mode : { sor::boundary::zero, sor::boundary::clamp, sor::boundary::periodic }) {
+				auto expected = volume;
+				for (std::size_t steps = 1; steps <= 6; ++steps) {
+					expected = reference(expected, weights, mode);
+					REQUIRE(distance(sor::stencil_apply(volume, weights, mode, steps), expected) < 1e-12);
+				}
+			}
+
+		}
+
+		THEN("convolution with a symmetric kernel is the stencil") {
+
+			sor::tensor<double, 3, 3, 3> symmetric;
+			for (std::size_t i = 0; i < symmetric.size(); ++i) { symmetric.data()[i] = weights.data()[i] + weights.data()[26 - i]; }
+			REQUIRE(distance(sor::convolve(volume, symmetric), sor::stencil_apply(volume, symmetric)) < 1e-12);
+
+		}
+
+	}
+
+}
\ No newline at end of file
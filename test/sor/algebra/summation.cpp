@@ -0,0 +1,202 @@
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <limits>
+
+#include "../../../deps/catch/include/catch.hpp"
+#include "../../../include/tensor.hpp"
+#include "../../../include/vector.hpp"
+#include "../../../include/matrix.hpp"
+#include "../../../include/algebra/vector.hpp"
+#include "../../../include/algebra/reduction.hpp"
+#include "../../../include/algebra/summation.hpp"
+
+namespace {
+
+	double relative_error(double value, double exact) {
+		return std::abs(value - exact) / std::abs(exact);
+	}
+
+}
+
+SCENARIO("summation policies", "[summation]") {
+
+	GIVEN("a long vector of floats of varying magnitude") {
+
+		constexpr std::size_t size = 1 << 20;
+		static sor::vector<float, size> vector;
+		static sor::vector<float, size> ones;
+		double exact_sum = 0, exact_squares = 0;
+		for (std::size_t i = 0; i < size; ++i) {
+			vector[i] = 1.0f / float(1 + i % 1000) + 0.1f;
+			ones[i] = 1.0f;
+			exact_sum += vector[i];
+			exact_squares += double(vector[i]) * vector[i];
+		}
+
+		WHEN("we sum it naively") {
+
+			float result = sor::sum<0>(vector);
+
+			THEN("the rounding errors accumulate") {
+
+				REQUIRE(relative_error(result, exact_sum) > 1e-5);
+
+			}
+
+		}
+
+		WHEN("we sum it pairwise or with compensation") {
+
+			float pairwise = sor::sum<0>(vector, sor::summation::pairwise);
+			float compensated = sor::sum<0>(vector, sor::summation::kahan_babuska);
+
+			THEN("the sum is accurate to a few units in the last place") {
+
+				REQUIRE(relative_error(pairwise, exact_sum) < 1e-6);
+				REQUIRE(relative_error(compensated, exact_sum) < 1e-7);
+
+			}
+
+		}
+
+		WHEN("we compute its dot products and norm with each policy") {
+
+			THEN("the pairwise and compensated results are accurate") {
+
+				REQUIRE(relative_error(sor::dot_product(vector, ones), exact_sum) > 1e-4);
+				REQUIRE(relative_error(sor::dot_product(vector, ones, sor::summation::pairwise), exact_sum) < 1e-6);
+				REQUIRE(relative_error(sor::dot_product(vector, ones, sor::summation::kahan_babuska), exact_sum) < 1e-7);
+				REQUIRE(relative_error(sor::euclidean_norm(vector, sor::summation::pairwise), std::sqrt(exact_squares)) < 1e-6);
+				REQUIRE(relative_error(sor::euclidean_norm(vector, sor::summation::kahan_babuska), std::sqrt(exact_squares)) < 1e-7);
+
+			}
+
+		}
+
+	}
+
+	GIVEN("terms that cancel") {
+
+		sor::vector<double, 4> vector({ 1.0, 1e100, 1.0, -1e100 });
+
+		WHEN("we sum them with compensation") {
+
+			THEN("the small terms are kept") {
+
+				REQUIRE(sor::sum<0>(vector) == 0.0);
+				REQUIRE(sor::sum<0>(vector, sor::summation::kahan_babuska) == 2.0);
+
+			}
+
+		}
+
+	}
+
+	GIVEN("a tall matrix") {
+
+		static sor::matrix<float, 3000, 3> matrix;
+		for (std::size_t i = 0; i < 3000; ++i) {
+			for (std::size_t j = 0; j < 3; ++j) { matrix(i, j) = float(i % 7) + 0.1f * float(j); }
+		}
+
+		WHEN("we sum and average its columns with each policy") {
+
+			auto naive = sor::sum<0>(matrix);
+			auto pairwise = sor::sum<0>(matrix, sor::summation::pairwise);
+			auto compensated = sor::sum<0>(matrix, sor::summation::kahan_babuska);
+			auto mean = sor::mean<0>(matrix, sor::summation::pairwise);
+
+			THEN("the results agree, more closely with a policy") {
+
+				for (std::size_t j = 0; j < 3; ++j) {
+					double exact = 0;
+					for (std::size_t i = 0; i < 3000; ++i) { exact += matrix(i, j); }
+					REQUIRE(naive[j] == Approx(exact).epsilon(1e-4));
+					REQUIRE(pairwise[j] == Approx(exact));
+					REQUIRE(compensated[j] == Approx(exact));
+					REQUIRE(mean[j] == Approx(exact / 3000));
+				}
+
+			}
+
+		}
+
+	}
+
+	GIVEN("integers") {
+
+		constexpr sor::vector<int, 5> vector({ 1, 2, 3, 4, 5 });
+
+		THEN("every policy gives the exact sum, also in constant expressions") {
+
+			static_assert(sor::dot_product(vector, vector, sor::summation::pairwise) == 55, "pairwise dot product");
+			static_assert(sor::dot_product(vector, vector, sor::summation::kahan_babuska) == 55, "compensated dot product");
+			REQUIRE(sor::sum<0>(vector, sor::summation::pairwise) == 15);
+			REQUIRE(sor::sum<0>(vector, sor::summation::kahan_babuska) == 15);
+
+		}
+
+	}
+
+	GIVEN("a term that is infinite") {
+
+		double const infinity = std::numeric_limits<double>::infinity();
+		sor::vector<double, 4> vector({ 1.0, infinity, 2.0, 3.0 });
+		sor::vector<double, 4> ones({ 1.0, 1.0, 1.0, 1.0 });
+
+		THEN("every policy gives an infinite result") {
+
+			REQUIRE(sor::dot_product(vector, ones) == infinity);
+			REQUIRE(sor::dot_product(vector, ones, sor::summation::pairwise) == infinity);
+			REQUIRE(sor::dot_product(vector, ones, sor::summation::kahan_babuska) == infinity);
+			REQUIRE(sor::sum<0>(vector, sor::summation::kahan_babuska) == infinity);
+
+		}
+
+		THEN("so does an overflowing sum of squares") {
+
+			sor::vector<double, 2> large({ 1e308, 1e308 });
+			REQUIRE(sor::euclidean_norm(large, sor::summation::kahan_babuska) == infinity);
+
+		}
+
+		THEN("so do the compensated sums of the columns of a matrix") {
+
+			sor::matrix<double, 3, 2> matrix({
+				1.0, 1.0,
+				infinity, 2.0,
+				3.0, 4.0
+			});
+			auto result = sor::sum<0>(matrix, sor::summation::kahan_babuska);
+			REQUIRE(result[0] == infinity);
+			REQUIRE(result[1] == 7.0);
+
+		}
+
+	}
+
+	GIVEN("complex elements") {
+
+		using complex = std::complex<double>;
+		sor::vector<complex, 3> vector({ complex(1, 2), complex(3, -1), complex(0, 1) });
+		sor::matrix<complex, 2, 2> matrix({
+			complex(1, 1), complex(2, 0),
+			complex(0, -1), complex(1, 3)
+		});
+
+		THEN("every policy sums them") {
+
+			for (auto mode : { sor::summation::naive, sor::summation::pairwise, sor::summation::kahan_babuska }) {
+				REQUIRE(sor::dot_product(vector, vector, mode) == complex(4, -2));
+				auto columns = sor::sum<0>(matrix, mode);
+				REQUIRE(columns[0] == complex(1, 0));
+				REQUIRE(columns[1] == complex(3, 3));
+				REQUIRE(sor::sum<0>(vector, mode) == complex(4, 2));
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,171 @@
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "../../../deps/catch/include/catch.hpp"
+#include "../../../include/vector.hpp"
+#include "../../../include/matrix.hpp"
+#include "../../../include/algebra/matrix.hpp"
+#include "../../../include/algebra/svd.hpp"
+
+namespace {
+
+	/* Checks that the `K` components of `decomposition` are orthonormal, descending
+	 * and reproduce `a` up to `tolerance`, assuming it has rank `K`.
+	*/
+	template<typename Type, std::size_t M, std::size_t N, std::size_t K>
+	void check_decomposition(sor::matrix<Type, M, N> const& a, sor::svd_decomposition<Type, M, N, K> const& svd, double tolerance) {
+		REQUIRE(svd.converged);
+		for (std::size_t j = 0; j + 1 < K; ++j) {
+			REQUIRE(svd.singular_values[j] >= svd.singular_values[j + 1]);
+		}
+		for (std::size_t i = 0; i < K; ++i) {
+			for (std::size_t j = 0; j < K; ++j) {
+				double u = 0, v = 0;
+				for (std::size_t k = 0; k < M; ++k) { u += svd.u(k, i) * svd.u(k, j); }
+				for (std::size_t k = 0; k < N; ++k) { v += svd.v(k, i) * svd.v(k, j); }
+				REQUIRE(std::abs(u - (i == j ? 1 : 0)) < tolerance);
+				REQUIRE(std::abs(v - (i == j ? 1 : 0)) < tolerance);
+			}
+		}
+		for (std::size_t i = 0; i < M; ++i) {
+			for (std::size_t j = 0; j < N; ++j) {
+				double sum = 0;
+				for (std::size_t k = 0; k < K; ++k) { sum += svd.u(i, k) * svd.singular_values[k] * svd.v(j, k); }
+				REQUIRE(std::abs(sum - a(i, j)) < tolerance);
+			}
+		}
+	}
+
+}
+
+SCENARIO("singular value decomposition", "[algebra]") {
+
+	GIVEN("a matrix with known singular values") {
+
+		sor::matrix<double, 3, 2> a({
+			3, 0,
+			0, -4,
+			0, 0
+		});
+
+		WHEN("we decompose it") {
+
+			auto svd = sor::svd(a);
+
+			THEN("we get them in descending order") {
+
+				REQUIRE(svd.singular_values[0] == Approx(4));
+				REQUIRE(svd.singular_values[1] == Approx(3));
+				check_decomposition(a, svd, 1e-12);
+
+			}
+
+		}
+
+	}
+
+	GIVEN("tall and wide matrices") {
+
+		static sor::matrix<float, 20, 7> tall;
+		static sor::matrix<double, 9, 33> wide;
+		for (std::size_t i = 0; i < 20; ++i) {
+			for (std::size_t j = 0; j < 7; ++j) { tall(i, j) = std::sin(float(i * 7 + j)); }
+		}
+		for (std::size_t i = 0; i < 9; ++i) {
+			for (std::size_t j = 0; j < 33; ++j) { wide(i, j) = std::cos(double(i * 33 + j) * 0.3); }
+		}
+
+		WHEN("we decompose them") {
+
+			auto tall_svd = sor::svd(tall);
+			auto wide_svd = sor::svd(wide);
+
+			THEN("the factors reproduce them") {
+
+				check_decomposition(tall, tall_svd, 1e-5);
+				check_decomposition(wide, wide_svd, 1e-10);
+
+			}
+
+		}
+
+	}
+
+	GIVEN("a rank deficient matrix") {
+
+		sor::matrix<double, 3, 3> a({
+			1, 2, 3,
+			2, 4, 6,
+			1, 0, 1
+		});
+
+		WHEN("we compute its pseudo inverse") {
+
+			auto inverse = sor::pseudo_inverse(a);
+			auto product = a * inverse * a;
+
+			THEN("it satisfies the Moore-Penrose conditions") {
+
+				auto other = inverse * a * inverse;
+				for (std::size_t i = 0; i < 3; ++i) {
+					for (std::size_t j = 0; j < 3; ++j) {
+						REQUIRE(std::abs(product(i, j) - a(i, j)) < 1e-10);
+						REQUIRE(std::abs(other(i, j) - inverse(i, j)) < 1e-10);
+					}
+				}
+
+			}
+
+		}
+
+	}
+
+}
+
+SCENARIO("truncated singular value decomposition", "[algebra]") {
+
+	GIVEN("a large matrix of low rank") {
+
+		constexpr std::size_t m = 300, n = 120, rank = 5;
+		static sor::matrix<double, m, n> a;
+		for (std::size_t i = 0; i < m; ++i) {
+			for (std::size_t j = 0; j < n; ++j) {
+				double sum = 0;
+				for (std::size_t k = 0; k < rank; ++k) {
+					sum += std::pow(0.5, double(k)) * std::sin(double((i + 1) * (k + 1))) * std::cos(double((j + 2) * (k + 3)));
+				}
+				a(i, j) = sum;
+			}
+		}
+
+		WHEN("we keep as many components as its rank") {
+
+			std::vector<double> workspace;
+			auto top = sor::truncated_svd<rank>(a, workspace);
+			auto full = sor::svd(a);
+
+			THEN("they reproduce the matrix and match the full decomposition") {
+
+				check_decomposition(a, top, 1e-9);
+				for (std::size_t k = 0; k < rank; ++k) {
+					REQUIRE(top.singular_values[k] == Approx(full.singular_values[k]));
+				}
+				REQUIRE(full.singular_values[rank] < 1e-9);
+
+			}
+
+			THEN("the workspace can be reused") {
+
+				auto capacity = workspace.capacity();
+				auto again = sor::truncated_svd<rank>(a, workspace);
+				REQUIRE(workspace.capacity() == capacity);
+				REQUIRE(again.singular_values[0] == Approx(top.singular_values[0]));
+
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
@@ -1,6 +1,9 @@
+#include <cstdint>
+
 #include "../../../deps/catch/include/catch.hpp"
 #include "../../../include/vector.hpp"
 #include "../../../include/algebra/vector.hpp"
+#include "../../../include/float16.hpp"
 
 SCENARIO("vector x, y, z, w element access", "[vector]") {
 
@@ -303,4 +306,90 @@ SCENARIO("vector dot product", "[vector]") {
 
 	}
 
+}
+
+SCENARIO("vector cross product", "[vector]") {
+
+	GIVEN("two three dimensional vectors") {
+
+		constexpr sor::vector<int, 3> vector1({ 1, 3, -5 });
+		constexpr sor::vector<long, 3> vector2({ 4, -2, -1 });
+
+		WHEN("we calculate their cross product") {
+
+			constexpr auto result = sor::cross_product(vector1, vector2);
+
+			THEN("the result is correct") {
+
+				static_assert(result == sor::vector<long, 3>({ -13, -19, -14 }), "the cross product is a constant expression");
+				REQUIRE(sor::dot_product(result, vector1) == 0);
+				REQUIRE(sor::dot_product(result, vector2) == 0);
+
+			}
+
+			THEN("it is anticommutative") {
+
+				REQUIRE((sor::cross_product(vector2, vector1) == sor::vector<long, 3>({ 13, 19, 14 })));
+
+			}
+
+		}
+
+	}
+
+}
+
+SCENARIO("half precision dot product", "[vector]") {
+
+	GIVEN("half precision vectors longer than the half precision integers") {
+
+		sor::vector<sor::float16, 4096> vector1;
+		sor::vector<sor::float16, 4096> vector2;
+		for (std::size_t i = 0; i < 4096; ++i) { vector1[i] = vector2[i] = 1.0f; }
+
+		WHEN("we calculate the dot product of the two") {
+
+			auto result = sor::dot_product(vector1, vector2);
+
+			THEN("it is accumulated in float") {
+
+				constexpr bool is_float = std::is_same<decltype(result), float>::value;
+				REQUIRE(is_float);
+				REQUIRE(result == 4096);
+
+			}
+
+		}
+
+	}
+
+}
+
+SCENARIO("8 bit integer dot product", "[vector]") {
+
+	GIVEN("8 bit vectors whose products overflow 8 bits") {
+
+		sor::vector<std::int8_t, 1000> vector1;
+		sor::vector<std::int8_t, 1000> vector2;
+		for (std::size_t i = 0; i < 1000; ++i) {
+			vector1[i] = -128;
+			vector2[i] = i % 2 == 0 ? -128 : 127;
+		}
+
+		WHEN("we calculate the dot product of the two") {
+
+			auto result = sor::dot_product(vector1, vector2);
+
+			THEN("it is accumulated exactly in int") {
+
+				constexpr bool is_int = std::is_same<decltype(result), int>::value;
+				REQUIRE(is_int);
+				REQUIRE(result == 500 * 128 * 128 - 500 * 128 * 127);
+
+			}
+
+		}
+
+	}
+
 }
\ No newline at end of file
@@ -0,0 +1,81 @@
+#include "../../deps/catch/include/catch.hpp"
+#include "../../include/type_traits.hpp"
+#include "../../include/matrix.hpp"
+#include "../../include/banded_matrix.hpp"
+
+SCENARIO("banded matrices", "[banded_matrix]") {
+
+	GIVEN("a banded matrix with one diagonal below and two above") {
+
+		sor::matrix<int, 4, 4> dense({
+			1, 2, 3, 4,
+			5, 6, 7, 8,
+			9, 10, 11, 12,
+			13, 14, 15, 16
+		});
+		sor::banded_matrix<int, 4, 1, 2> banded(dense);
+
+		THEN("only the band is stored, a row at a time") {
+
+			REQUIRE(banded.size() == 16);
+			REQUIRE(banded.width == 4);
+			REQUIRE(banded.data()[1] == 1);
+			REQUIRE(banded.data()[4] == 5);
+			REQUIRE(banded.data()[7] == 8);
+			REQUIRE(banded.stored(2, 1));
+			REQUIRE(!banded.stored(2, 0));
+			REQUIRE(banded.stored(0, 2));
+			REQUIRE(!banded.stored(0, 3));
+
+		}
+
+		THEN("elements outside of the band are zero") {
+
+			auto const& constant = banded;
+			REQUIRE(constant(1, 0) == 5);
+			REQUIRE(constant(1, 3) == 8);
+			REQUIRE(constant(3, 0) == 0);
+			REQUIRE(constant(0, 3) == 0);
+			REQUIRE((sor::materialize(banded) == sor::matrix<int, 4, 4>({
+				1, 2, 3, 0,
+				5, 6, 7, 8,
+				0, 10, 11, 12,
+				0, 0, 15, 16
+			})));
+
+		}
+
+		WHEN("we assign to an element of the band") {
+
+			auto other = banded;
+			other(3, 2) = 0;
+
+			THEN("the matrices differ") {
+
+				REQUIRE(other(3, 2) == 0);
+				REQUIRE(other != banded);
+				REQUIRE(!(other == banded));
+
+			}
+
+		}
+
+	}
+
+	GIVEN("a tridiagonal matrix type") {
+
+		using tridiagonal_type = sor::tridiagonal_matrix<double, 5>;
+
+		THEN("it is a square matrix with three diagonals") {
+
+			REQUIRE(sor::order<tridiagonal_type>::value == 2);
+			REQUIRE((sor::extent<tridiagonal_type, 0>::value == 5));
+			REQUIRE((sor::extent<tridiagonal_type, 1>::value == 5));
+			REQUIRE(tridiagonal_type().size() == 15);
+			REQUIRE(tridiagonal_type()(2, 2) == 0);
+
+		}
+
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+#include "../../deps/catch/include/catch.hpp"
+#include "../../include/vector.hpp"
+#include "../../include/float16.hpp"
+
+SCENARIO("half precision floats", "[float16]") {
+
+	GIVEN("every half precision encoding") {
+
+		THEN("converting to float and back gives the same encoding") {
+
+			bool all_equal = true;
+			for (std::uint32_t bits = 0; bits < 0x10000; ++bits) {
+				sor::float16 const value = sor::float16::from_bits(std::uint16_t(bits));
+				float const widened = value;
+				if (std::isnan(widened)) {
+					all_equal = all_equal && std::isnan(float(sor::float16(widened)));
+				} else {
+					all_equal = all_equal && sor::float16(widened).bits() == bits;
+				}
+			}
+			REQUIRE(all_equal);
+
+		}
+
+	}
+
+	GIVEN("floats between representable halves") {
+
+		THEN("they are rounded to nearest, ties to even") {
+
+			REQUIRE(sor::float16(1.0f).bits() == 0x3c00);
+			REQUIRE(sor::float16(1.0f + std::ldexp(1.0f, -11)).bits() == 0x3c00);
+			REQUIRE(sor::float16(1.0f + 3 * std::ldexp(1.0f, -11)).bits() == 0x3c02);
+			REQUIRE(sor::float16(1.0f + std::ldexp(1.0f, -11) + std::ldexp(1.0f, -20)).bits() == 0x3c01);
+			REQUIRE(sor::float16(-2.0f).bits() == 0xc000);
+			REQUIRE(float(sor::float16(0.1f)) == 0.0999755859375f);
+
+		}
+
+		THEN("subnormals, overflow and special values are handled") {
+
+			REQUIRE(sor::float16(std::ldexp(1.0f, -24)).bits() == 0x0001);
+			REQUIRE(sor::float16(std::ldexp(1.0f, -26)).bits() == 0x0000);
+			REQUIRE(sor::float16(std::ldexp(3.0f, -26)).bits() == 0x0001);
+			REQUIRE(sor::float16(65504.0f).bits() == 0x7bff);
+			REQUIRE(sor::float16(65519.0f).bits() == 0x7bff);
+			REQUIRE(sor::float16(65520.0f).bits() == 0x7c00);
+			REQUIRE(sor::float16(-1e10f).bits() == 0xfc00);
+			REQUIRE(std::isnan(float(sor::float16(std::numeric_limits<float>::quiet_NaN()))));
+			REQUIRE(float(std::numeric_limits<sor::float16>::max()) == 65504.0f);
+			REQUIRE(float(std::numeric_limits<sor::float16>::epsilon()) == std::ldexp(1.0f, -10));
+			REQUIRE(std::numeric_limits<sor::float16>::digits10 == 3);
+			REQUIRE(std::numeric_limits<sor::float16>::max_exponent10 == 4);
+			REQUIRE(float(std::numeric_limits<sor::float16>::round_error()) == 0.5f);
+			REQUIRE(std::isnan(float(std::numeric_limits<sor::float16>::signaling_NaN())));
+
+		}
+
+	}
+
+	GIVEN("half precision values in expressions") {
+
+		sor::float16 value(1.5f);
+
+		THEN("they are evaluated in float and rounded when stored") {
+
+			constexpr bool is_float = std::is_same<decltype(value * value), float>::value;
+			REQUIRE(is_float);
+			value += 2;
+			REQUIRE(float(value) == 3.5f);
+			value *= 3;
+			REQUIRE(value == 10.5f);
+			REQUIRE(value < 11);
+
+		}
+
+		THEN("they widen to the other floating point types") {
+
+			constexpr bool with_half = std::is_same<std::common_type<sor::float16, sor::float16>::type, sor::float16>::value;
+			constexpr bool with_float = std::is_same<std::common_type<sor::float16, float>::type, float>::value;
+			constexpr bool with_double = std::is_same<std::common_type<double, sor::float16>::type, double>::value;
+			constexpr bool with_int = std::is_same<std::common_type<sor::float16, int>::type, float>::value;
+			constexpr bool with_brain = std::is_same<std::common_type<sor::float16, sor::bfloat16>::type, float>::value;
+			REQUIRE(with_half);
+			REQUIRE(with_float);
+			REQUIRE(with_double);
+			REQUIRE(with_int);
+			REQUIRE(with_brain);
+
+		}
+
+		THEN("positive and negative zero hash the same") {
+
+			REQUIRE(std::hash<sor::float16>()(sor::float16(0.0f)) == std::hash<sor::float16>()(sor::float16(-0.0f)));
+
+		}
+
+	}
+
+}
+
+SCENARIO("brain floats", "[float16]") {
+
+	GIVEN("floats") {
+
+		THEN("they keep their upper half, rounded to nearest even") {
+
+			REQUIRE(sor::bfloat16(1.0f).bits() == 0x3f80);
+			REQUIRE(sor::bfloat16(1.0f + std::ldexp(1.0f, -8)).bits() == 0x3f80);
+			REQUIRE(sor::bfloat16(1.0f + 3 * std::ldexp(1.0f, -8)).bits() == 0x3f82);
+			REQUIRE(sor::bfloat16(3e38f).bits() == 0x7f62);
+			REQUIRE(std::isinf(float(sor::bfloat16(std::numeric_limits<float>::infinity()))));
+			REQUIRE(std::isnan(float(sor::bfloat16(std::numeric_limits<float>::quiet_NaN()))));
+			REQUIRE(std::numeric_limits<sor::bfloat16>::digits10 == 2);
+			REQUIRE(std::numeric_limits<sor::bfloat16>::min_exponent10 == -37);
+			REQUIRE(float(std::numeric_limits<sor::bfloat16>::round_error()) == 0.5f);
+			REQUIRE(std::isnan(float(std::numeric_limits<sor::bfloat16>::signaling_NaN())));
+
+		}
+
+	}
+
+	GIVEN("a tensor of brain floats") {
+
+		sor::vector<sor::bfloat16, 3> vector({ 0.5f, -2.0f, 8.0f });
+
+		THEN("it stores two bytes per element") {
+
+			REQUIRE(sizeof(vector) == 6);
+			REQUIRE(float(vector[1]) == -2.0f);
+			REQUIRE((vector == sor::vector<sor::bfloat16, 3>({ 0.5f, -2.0f, 8.0f })));
+
+		}
+
+	}
+
+}
\ No newline at end of file
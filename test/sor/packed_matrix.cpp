@@ -0,0 +1,121 @@
+#include "../../deps/catch/include/catch.hpp"
+#include "../../include/matrix.hpp"
+#include "../../include/packed_matrix.hpp"
+
+SCENARIO("packed matrices", "[packed_matrix]") {
+
+	GIVEN("packed matrices of every kind") {
+
+		sor::symmetric_matrix<int, 3> symmetric({
+			1,
+			2, 3,
+			4, 5, 6
+		});
+		sor::lower_triangular<int, 3> lower({
+			1,
+			2, 3,
+			4, 5, 6
+		});
+		sor::upper_triangular<int, 3> upper({
+			1, 2, 3,
+			4, 5,
+			6
+		});
+		sor::diagonal_matrix<int, 3> diagonal({ 1, 2, 3 });
+
+		THEN("they only store the elements that aren't known") {
+
+			REQUIRE(symmetric.size() == 6);
+			REQUIRE(lower.size() == 6);
+			REQUIRE(upper.size() == 6);
+			REQUIRE(diagonal.size() == 3);
+			REQUIRE(sizeof(symmetric) == 6 * sizeof(int));
+
+		}
+
+		THEN("elements are mapped onto the packed layout") {
+
+			REQUIRE(symmetric(2, 1) == 5);
+			REQUIRE(symmetric(1, 2) == 5);
+			REQUIRE(lower(2, 1) == 5);
+			REQUIRE(upper(1, 2) == 5);
+			REQUIRE(diagonal(2, 2) == 3);
+
+		}
+
+		THEN("elements that aren't stored are zero") {
+
+			auto const& constant_lower = lower;
+			auto const& constant_upper = upper;
+			auto const& constant_diagonal = diagonal;
+			REQUIRE(constant_lower(1, 2) == 0);
+			REQUIRE(constant_upper(2, 1) == 0);
+			REQUIRE(constant_diagonal(0, 1) == 0);
+			REQUIRE(!lower.stored(0, 2));
+			REQUIRE(upper.stored(0, 2));
+
+		}
+
+		WHEN("we assign to an element of a symmetric matrix") {
+
+			symmetric(0, 2) = 9;
+
+			THEN("its mirror image changes too") {
+
+				REQUIRE(symmetric(2, 0) == 9);
+
+			}
+
+		}
+
+		WHEN("we convert them to dense matrices") {
+
+			THEN("the known elements are filled in") {
+
+				REQUIRE((sor::materialize(symmetric) == sor::matrix<int, 3, 3>({
+					1, 2, 4,
+					2, 3, 5,
+					4, 5, 6
+				})));
+				REQUIRE((sor::materialize(upper) == sor::matrix<int, 3, 3>({
+					1, 2, 3,
+					0, 4, 5,
+					0, 0, 6
+				})));
+				REQUIRE((sor::materialize(diagonal) == sor::matrix<int, 3, 3>({
+					1, 0, 0,
+					0, 2, 0,
+					0, 0, 3
+				})));
+
+			}
+
+		}
+
+	}
+
+	GIVEN("a dense matrix") {
+
+		sor::matrix<int, 2, 2> dense({
+			1, 2,
+			3, 4
+		});
+
+		WHEN("we pack it") {
+
+			sor::lower_triangular<long, 2> lower(dense);
+			sor::upper_triangular<long, 2> upper(dense);
+
+			THEN("only the relevant triangle is kept") {
+
+				REQUIRE((lower == sor::lower_triangular<long, 2>({ 1, 3, 4 })));
+				REQUIRE((upper == sor::upper_triangular<long, 2>({ 1, 2, 4 })));
+				REQUIRE((upper != sor::upper_triangular<long, 2>({ 1, 3, 4 })));
+
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
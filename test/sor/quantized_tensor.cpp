@@ -0,0 +1,49 @@
+#include <cstdint>
+#include <type_traits>
+
+#include "../../deps/catch/include/catch.hpp"
+#include "../../include/tensor.hpp"
+#include "../../include/quantized_tensor.hpp"
+
+SCENARIO("quantized tensors", "[quantized_tensor]") {
+
+	GIVEN("a tensor quantized per tensor") {
+
+		using tensor_type = sor::quantized_tensor<sor::quantization::per_tensor, 2, 3, 4>;
+
+		THEN("all the elements share a single scale and zero point") {
+
+			static_assert(tensor_type::groups == 1, "a single group");
+			static_assert(tensor_type::group_size == 24, "every element in the group");
+			static_assert(std::is_same<decltype(tensor_type::values), sor::tensor<std::int8_t, 2, 3, 4>>::value, "8 bit values");
+			REQUIRE(tensor_type().scales.size() == 1);
+
+		}
+
+	}
+
+	GIVEN("a matrix quantized per row") {
+
+		using matrix_type = sor::quantized_matrix<sor::quantization::per_row, 5, 7>;
+		matrix_type q;
+
+		THEN("each row has its own scale and zero point") {
+
+			static_assert(matrix_type::groups == 5, "one group per row");
+			static_assert(matrix_type::group_size == 7, "one row per group");
+			REQUIRE(q.scales.size() == 5);
+			REQUIRE(q.zero_points.size() == 5);
+
+		}
+
+		THEN("it is value initialized") {
+
+			REQUIRE(q.values(4, 6) == 0);
+			REQUIRE(q.scales[0] == 0);
+			REQUIRE(q.zero_points[4] == 0);
+
+		}
+
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+#include "../../deps/catch/include/catch.hpp"
+#include "../../include/vector.hpp"
+#include "../../include/quaternion.hpp"
+
+SCENARIO("quaternions", "[quaternion]") {
+
+	GIVEN("a default constructed quaternion") {
+
+		constexpr sor::quaternion<double> q;
+
+		THEN("it is the identity rotation") {
+
+			static_assert(q.w() == 1, "the default quaternion is a constant expression");
+			REQUIRE((q == sor::quaternion<double>(0, 0, 0, 1)));
+
+		}
+
+	}
+
+	GIVEN("a quaternion from its components") {
+
+		sor::quaternion<int> q(1, 2, 3, 4);
+
+		THEN("the imaginary part comes first") {
+
+			REQUIRE(q.x() == 1);
+			REQUIRE(q.y() == 2);
+			REQUIRE(q.z() == 3);
+			REQUIRE(q.w() == 4);
+			REQUIRE((q.components() == sor::vector<int, 4>({ 1, 2, 3, 4 })));
+			REQUIRE((q.imaginary() == sor::vector<int, 3>({ 1, 2, 3 })));
+
+		}
+
+		WHEN("a component is assigned") {
+
+			q.w() = 5;
+
+			THEN("it is no longer equal to the original") {
+
+				REQUIRE((q != sor::quaternion<int>(1, 2, 3, 4)));
+				REQUIRE((q == sor::quaternion<int>(sor::vector<int, 4>({ 1, 2, 3, 5 }))));
+
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,117 @@
+#include <cstddef>
+
+#include "../../deps/catch/include/catch.hpp"
+#include "../../include/matrix.hpp"
+#include "../../include/sparse_matrix.hpp"
+
+SCENARIO("sparse matrices", "[sparse_matrix]") {
+
+	GIVEN("a matrix in coordinate format with duplicates") {
+
+		sor::coo_matrix<int, 3, 4> coo;
+		coo.insert(2, 3, 5);
+		coo.insert(0, 1, 1);
+		coo.insert(2, 0, 4);
+		coo.insert(0, 1, 2);
+		coo.insert(1, 2, 6);
+
+		sor::matrix<int, 3, 4> dense({
+			0, 3, 0, 0,
+			0, 0, 6, 0,
+			4, 0, 0, 5
+		});
+
+		THEN("duplicates are summed when materialized") {
+
+			REQUIRE(coo.non_zeros() == 5);
+			REQUIRE((sor::materialize(coo) == dense));
+
+		}
+
+		WHEN("we compress it by rows") {
+
+			sor::csr_matrix<int, 3, 4> csr(coo);
+
+			THEN("the rows are sorted and the duplicates merged") {
+
+				REQUIRE(csr.non_zeros() == 4);
+				REQUIRE((csr.row_offsets() == std::vector<std::size_t>{ 0, 1, 2, 4 }));
+				REQUIRE((csr.column_indexes() == std::vector<std::size_t>{ 1, 2, 0, 3 }));
+				REQUIRE((csr.values() == std::vector<int>{ 3, 6, 4, 5 }));
+				REQUIRE(csr(2, 3) == 5);
+				REQUIRE(csr(2, 2) == 0);
+				REQUIRE((sor::materialize(csr) == dense));
+
+			}
+
+		}
+
+		WHEN("we compress it by columns") {
+
+			sor::csc_matrix<int, 3, 4> csc(coo);
+
+			THEN("the columns are sorted and the duplicates merged") {
+
+				REQUIRE((csc.column_offsets() == std::vector<std::size_t>{ 0, 1, 2, 3, 4 }));
+				REQUIRE((csc.row_indexes() == std::vector<std::size_t>{ 2, 0, 1, 2 }));
+				REQUIRE((csc.values() == std::vector<int>{ 4, 3, 6, 5 }));
+				REQUIRE(csc(0, 1) == 3);
+				REQUIRE(csc(1, 1) == 0);
+				REQUIRE((sor::materialize(csc) == dense));
+
+			}
+
+		}
+
+		WHEN("we compress the dense matrix directly") {
+
+			sor::csr_matrix<int, 3, 4> csr(dense);
+			sor::csc_matrix<int, 3, 4> csc(dense);
+
+			THEN("only its nonzero elements are stored") {
+
+				REQUIRE(csr.non_zeros() == 4);
+				REQUIRE(csc.non_zeros() == 4);
+				REQUIRE((sor::materialize(csr) == dense));
+				REQUIRE((sor::materialize(csc) == dense));
+
+			}
+
+		}
+
+	}
+
+	GIVEN("a large matrix in coordinate format") {
+
+		constexpr std::size_t n = 200;
+		sor::coo_matrix<long, n, n> coo;
+		coo.reserve(3 * n * n / 2);
+		for (std::size_t e = 0; e < 3 * n * n / 2; ++e) {
+			std::size_t const i = (e * 7919) % n;
+			std::size_t const j = (e * 104729 + e / n) % n;
+			coo.insert(i, j, long(e % 13) - 6);
+		}
+
+		WHEN("we compress it") {
+
+			sor::csr_matrix<long, n, n> csr(coo);
+			sor::csc_matrix<long, n, n> csc(coo);
+
+			THEN("it represents the same matrix") {
+
+				auto const expected = sor::materialize(coo);
+				REQUIRE((sor::materialize(csr) == expected));
+				REQUIRE((sor::materialize(csc) == expected));
+				for (std::size_t i = 0; i < n; ++i) {
+					for (std::size_t e = csr.row_offsets()[i] + 1; e < csr.row_offsets()[i + 1]; ++e) {
+						REQUIRE(csr.column_indexes()[e - 1] < csr.column_indexes()[e]);
+					}
+				}
+
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
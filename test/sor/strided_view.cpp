@@ -0,0 +1,136 @@
+#include <type_traits>
+#include <numeric>
+
+#include "../../deps/catch/include/catch.hpp"
+#include "../../include/tensor.hpp"
+#include "../../include/matrix.hpp"
+#include "../../include/strided_view.hpp"
+
+SCENARIO("tensor axes permutation", "[strided_view]") {
+
+	GIVEN("a non constant order 3 tensor") {
+
+		sor::tensor<int, 2, 3, 4> tensor;
+		std::iota(tensor.begin(), tensor.end(), 0);
+
+		WHEN("we permute its axes") {
+
+			auto view = tensor.permute<2, 0, 1>();
+
+			THEN("we get a view with permuted extents over the same storage") {
+
+				constexpr bool is_expected_type = std::is_same<
+					decltype(view),
+					sor::strided_view<int, 4, 2, 3>
+				>::value;
+				REQUIRE(is_expected_type);
+				REQUIRE(view.data() == tensor.data());
+				REQUIRE(view(3, 1, 2) == tensor(1, 2, 3));
+				REQUIRE(view(0, 1, 0) == tensor(1, 0, 0));
+
+			}
+
+			THEN("modifications through the view are reflected in the tensor") {
+
+				view(2, 0, 1) = -1;
+				REQUIRE(tensor(0, 1, 2) == -1);
+
+			}
+
+			THEN("permuting the view back gives the original layout") {
+
+				auto back = view.permute<1, 2, 0>();
+				REQUIRE(back(1, 2, 3) == tensor(1, 2, 3));
+				REQUIRE(sor::materialize(back) == tensor);
+
+			}
+
+		}
+
+		WHEN("we materialize the permutation") {
+
+			auto permuted = sor::materialize(tensor.permute<2, 0, 1>());
+
+			THEN("we get a tensor with the permuted layout") {
+
+				constexpr bool is_expected_type = std::is_same<
+					decltype(permuted),
+					sor::tensor<int, 4, 2, 3>
+				>::value;
+				REQUIRE(is_expected_type);
+
+				bool all_equal = true;
+				for (std::size_t i = 0; i < 2; ++i) {
+					for (std::size_t j = 0; j < 3; ++j) {
+						for (std::size_t k = 0; k < 4; ++k) {
+							all_equal = all_equal && permuted(k, i, j) == tensor(i, j, k);
+						}
+					}
+				}
+				REQUIRE(all_equal);
+
+			}
+
+		}
+
+	}
+
+	GIVEN("a temporary matrix") {
+
+		WHEN("we permute its axes") {
+
+			auto transposed = sor::matrix<int, 2, 3>({ 1, 2, 3, 4, 5, 6 }).permute<1, 0>();
+
+			THEN("we directly get the transposed matrix") {
+
+				sor::matrix<int, 3, 2> expected({
+					1, 4,
+					2, 5,
+					3, 6
+				});
+				REQUIRE(transposed == expected);
+
+			}
+
+		}
+
+	}
+
+	GIVEN("a tensor larger than the transposition tiles") {
+
+		static sor::tensor<long, 19, 37, 41> tensor;
+		std::iota(tensor.begin(), tensor.end(), 0);
+
+		WHEN("we materialize each permutation of its axes") {
+
+			auto p021 = sor::materialize(tensor.permute<0, 2, 1>());
+			auto p102 = sor::materialize(tensor.permute<1, 0, 2>());
+			auto p120 = sor::materialize(tensor.permute<1, 2, 0>());
+			auto p201 = sor::materialize(tensor.permute<2, 0, 1>());
+			auto p210 = sor::materialize(tensor.permute<2, 1, 0>());
+
+			THEN("every element ends up in its permuted position") {
+
+				bool all_equal = true;
+				for (std::size_t i = 0; i < 19; ++i) {
+					for (std::size_t j = 0; j < 37; ++j) {
+						for (std::size_t k = 0; k < 41; ++k) {
+							auto value = tensor(i, j, k);
+							all_equal = all_equal &&
+								p021(i, k, j) == value &&
+								p102(j, i, k) == value &&
+								p120(j, k, i) == value &&
+								p201(k, i, j) == value &&
+								p210(k, j, i) == value;
+						}
+					}
+				}
+				REQUIRE(all_equal);
+
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file
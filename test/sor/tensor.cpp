@@ -1,5 +1,8 @@
 #include <type_traits>
 #include <algorithm>
+#include <limits>
+#include <numeric>
+#include <unordered_set>
 
 #include "../../deps/catch/include/catch.hpp"
 #include "../../include/tensor.hpp"
@@ -867,6 +870,87 @@ SCENARIO("tensor equality", "[tensor]") {
 
 }
 
+SCENARIO("tensor equality of large and floating point tensors", "[tensor]") {
+
+	GIVEN("two large integer tensors that differ in the last element") {
+
+		sor::tensor<int, 16, 33> tensor1;
+		std::fill(tensor1.begin(), tensor1.end(), 7);
+		sor::tensor<int, 16, 33> tensor2(tensor1);
+		tensor2(15, 32) = 8;
+
+		WHEN("we test for equality") {
+
+			THEN("they are only equal once the last element matches") {
+
+				REQUIRE(tensor1 != tensor2);
+				tensor2(15, 32) = 7;
+				REQUIRE(tensor1 == tensor2);
+
+			}
+
+		}
+
+	}
+
+	GIVEN("two tensors of different integer types") {
+
+		sor::tensor<int, 2, 2> tensor1({ -1, 2, 3, 4 });
+		sor::tensor<long, 2, 2> tensor2({ -1l, 2l, 3l, 4l });
+
+		WHEN("we test for equality") {
+
+			THEN("values are compared rather than representations") {
+
+				REQUIRE(tensor1 == tensor2);
+
+			}
+
+		}
+
+	}
+
+	GIVEN("two floating point tensors with zeros of opposite sign") {
+
+		sor::tensor<float, 5, 7> tensor1;
+		std::fill(tensor1.begin(), tensor1.end(), 1.5f);
+		sor::tensor<float, 5, 7> tensor2(tensor1);
+		tensor1(4, 6) = 0.0f;
+		tensor2(4, 6) = -0.0f;
+
+		WHEN("we test for equality") {
+
+			THEN("the result is positive") {
+
+				REQUIRE(tensor1 == tensor2);
+
+			}
+
+		}
+
+	}
+
+	GIVEN("two identical floating point tensors containing a NaN") {
+
+		sor::tensor<double, 5, 7> tensor1;
+		std::fill(tensor1.begin(), tensor1.end(), 2.5);
+		tensor1(0, 3) = std::numeric_limits<double>::quiet_NaN();
+		sor::tensor<double, 5, 7> tensor2(tensor1);
+
+		WHEN("we test for equality") {
+
+			THEN("the result is negative") {
+
+				REQUIRE(tensor1 != tensor2);
+
+			}
+
+		}
+
+	}
+
+}
+
 SCENARIO("tensor swap", "[tensor]") {
 
 	GIVEN("two tensors") {
@@ -1034,4 +1118,143 @@ SCENARIO("tensor size") {
 
 	}
 
+}
+
+SCENARIO("tensor constant expressions", "[tensor]") {
+
+	GIVEN("a tensor built in a constant expression") {
+
+		constexpr sor::tensor<int, 2, 3, 2> tensor({
+			1, 2,
+			3, 4,
+			5, 6,
+
+			7, 8,
+			9, 10,
+			11, 12
+		});
+
+		WHEN("we access its elements in a constant expression") {
+
+			constexpr auto first = tensor(0, 0, 0);
+			constexpr auto middle = tensor(0, 2, 1);
+			constexpr auto last = tensor(1, 2, 1);
+
+			THEN("we get the elements in row major order") {
+
+				REQUIRE(first == 1);
+				REQUIRE(middle == 6);
+				REQUIRE(last == 12);
+
+			}
+
+		}
+
+		WHEN("we copy it into a tensor of another type in a constant expression") {
+
+			constexpr sor::tensor<long, 2, 3, 2> copy(tensor);
+			constexpr bool are_equal = copy == tensor;
+
+			THEN("the two tensors are equal") {
+
+				REQUIRE(are_equal);
+
+			}
+
+		}
+
+	}
+
+	GIVEN("an initializer list shorter than the tensor") {
+
+		constexpr sor::tensor<int, 2, 2> tensor({ 1, 2, 3 });
+
+		WHEN("we access the elements that were not specified") {
+
+			constexpr auto missing = tensor(1, 1);
+
+			THEN("they are value initialized") {
+
+				REQUIRE(missing == 0);
+
+			}
+
+		}
+
+	}
+
+}
+
+SCENARIO("tensor hashing", "[tensor]") {
+
+	GIVEN("two equal integer tensors spanning several hash blocks") {
+
+		sor::tensor<int, 9, 61> tensor1;
+		std::iota(tensor1.begin(), tensor1.end(), -100);
+		sor::tensor<int, 9, 61> tensor2(tensor1);
+
+		WHEN("we hash them") {
+
+			std::hash<sor::tensor<int, 9, 61>> hash;
+
+			THEN("they hash equally") {
+
+				REQUIRE(hash(tensor1) == hash(tensor2));
+
+			}
+
+			THEN("changing a single element changes the hash") {
+
+				tensor2(8, 60) += 1;
+				REQUIRE(hash(tensor1) != hash(tensor2));
+
+			}
+
+		}
+
+	}
+
+	GIVEN("two equal floating point tensors with zeros of opposite sign") {
+
+		sor::tensor<float, 3, 5> tensor1;
+		std::fill(tensor1.begin(), tensor1.end(), 0.25f);
+		sor::tensor<float, 3, 5> tensor2(tensor1);
+		tensor1(1, 1) = 0.0f;
+		tensor2(1, 1) = -0.0f;
+
+		WHEN("we hash them") {
+
+			std::hash<sor::tensor<float, 3, 5>> hash;
+
+			THEN("they hash equally") {
+
+				REQUIRE(tensor1 == tensor2);
+				REQUIRE(hash(tensor1) == hash(tensor2));
+
+			}
+
+		}
+
+	}
+
+	GIVEN("a set of tensors") {
+
+		std::unordered_set<sor::tensor<double, 2, 2>> set;
+		set.insert(sor::tensor<double, 2, 2>({ 1.0, 2.0, 3.0, 4.0 }));
+		set.insert(sor::tensor<double, 2, 2>({ 4.0, 3.0, 2.0, 1.0 }));
+
+		WHEN("we insert a duplicate") {
+
+			set.insert(sor::tensor<double, 2, 2>({ 1.0, 2.0, 3.0, 4.0 }));
+
+			THEN("it is deduplicated") {
+
+				REQUIRE(set.size() == 2);
+
+			}
+
+		}
+
+	}
+
 }
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include <type_traits>
+#include <numeric>
+#include <algorithm>
+
+#include "../../deps/catch/include/catch.hpp"
+#include "../../include/tensor.hpp"
+#include "../../include/matrix.hpp"
+#include "../../include/tensor_view.hpp"
+
+SCENARIO("tensor reshaping", "[tensor_view]") {
+
+	GIVEN("a non constant order 3 tensor") {
+
+		sor::tensor<int, 2, 3, 4> tensor;
+		std::iota(tensor.begin(), tensor.end(), 0);
+
+		WHEN("we reshape it into a matrix") {
+
+			auto view = tensor.reshape<6, 4>();
+
+			THEN("the view shares the storage of the tensor") {
+
+				REQUIRE(view.data() == tensor.data());
+				REQUIRE(view.size() == 24);
+				REQUIRE(view(5, 3) == tensor(1, 2, 3));
+				REQUIRE(view(2, 1) == tensor(0, 2, 1));
+
+			}
+
+			THEN("modifications through the view are reflected in the tensor") {
+
+				view(4, 2) = -1;
+				REQUIRE(tensor(1, 1, 2) == -1);
+
+			}
+
+			THEN("the view has the new order and extents") {
+
+				using view_type = decltype(view);
+				using extent0 = sor::extent<view_type, 0>;
+				using extent1 = sor::extent<view_type, 1>;
+				REQUIRE(sor::order<view_type>::value == 2);
+				REQUIRE(extent0::value == 6);
+				REQUIRE(extent1::value == 4);
+
+			}
+
+		}
+
+		WHEN("we reshape the view again") {
+
+			auto view = tensor.reshape<24>().reshape<4, 3, 2>();
+
+			THEN("it still refers to the same storage") {
+
+				REQUIRE(view(3, 2, 1) == 23);
+				REQUIRE(std::equal(view.begin(), view.end(), tensor.begin(), tensor.end()));
+
+			}
+
+		}
+
+	}
+
+	GIVEN("a constant tensor") {
+
+		sor::tensor<int, 2, 2> const tensor({ 1, 2, 3, 4 });
+
+		WHEN("we reshape it") {
+
+			auto view = tensor.reshape<4>();
+
+			THEN("the view is of constant elements") {
+
+				constexpr bool is_constant = std::is_same<
+					decltype(view(0)),
+					int const&
+				>::value;
+				REQUIRE(is_constant);
+				REQUIRE(view(3) == 4);
+
+			}
+
+		}
+
+	}
+
+	GIVEN("a temporary tensor") {
+
+		WHEN("we reshape it") {
+
+			auto matrix = sor::tensor<int, 2, 3>({ 1, 2, 3, 4, 5, 6 }).reshape<3, 2>();
+
+			THEN("we get a tensor owning the same elements") {
+
+				sor::matrix<int, 3, 2> expected({
+					1, 2,
+					3, 4,
+					5, 6
+				});
+				REQUIRE(matrix == expected);
+
+			}
+
+		}
+
+	}
+
+}
\ No newline at end of file